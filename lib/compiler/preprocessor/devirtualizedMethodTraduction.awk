@@ -0,0 +1,18 @@
+NR == FNR {
+  rep[$1] = $2
+  next
+} 
+
+{
+  for (key in rep)
+  {
+    pattern="[ 	][ 	]*"key"[ 	]*[(]"
+    className=substr(rep[key], 1, match(rep[key], "_")-1)
+    replacement=" "rep[key]"(("className")"
+    if (0 < gsub(pattern, replacement) && report != "")
+    {
+      print FNR":	"key" -> "rep[key] >> report
+    }
+  }
+  print
+}
@@ -687,6 +687,8 @@ virtualMethodDeclarations=$virtualMethodDeclarations" "`grep -e "<virtual>" <<<
 virtualMethodOverrides=$virtualMethodOverrides" "`grep -e "<override>\|<virtual>" <<< "$methodDeclarations" | grep -v -e ")[ 	]*=[ 	]*0[ 	]*;" | sed -e 's/^.*[ 	][ 	]*\([a-z][A-z0-9]*\)(.*/ __VIRTUAL_SET(ClassName,'"$className"',\1);/g' | tr -d "\r\n"`
 #echo "."
 virtualMethodNames=`grep -e "<virtual>" <<< "$methodDeclarations" | sed -e 's/^.*[ 	][ 	]*\([a-z][A-z0-9]*\)(.*$/\1/g' | sed -e 's/,[ 	]*)[ 	]*;/);/g'`
+#echo "."
+implementedMethodNames=`grep -e "<override>\|<virtual>" <<< "$methodDeclarations" | grep -v -e ")[ 	]*=[ 	]*0[ 	]*;" | sed -e 's/^.*[ 	][ 	]*\([a-z][A-z0-9]*\)(.*$/\1/g'`
 
 #echo "."
 methodCalls=`grep -v -e "<static>\|<virtual>\|<override>" <<< "$methodDeclarations" | sed -e 's/^.*[ 	][ 	]*\([a-z][A-z0-9]*\)(.*$/'"$className"'_\1/g'`
@@ -712,6 +714,34 @@ then
 	echo "$methodCalls" >> $CLASS_INHERITED_METHODS_DICTIONARY
 fi
 
+echo "Writing implemented methods on caller $CALLER"  >> $CLASS_LOG_FILE
+
+# Keep track of the class that provides the implementation of each virtual method
+# so calls on classes that cannot be inherited from can bypass the virtual table
+CLASS_IMPLEMENTED_METHODS_DICTIONARY=$WORKING_FOLDER/classes/dictionaries/$className"MethodsImplemented.txt"
+
+if [ ! "$isExtensionClass" = true ];
+then
+	rm -f $CLASS_IMPLEMENTED_METHODS_DICTIONARY
+	touch $CLASS_IMPLEMENTED_METHODS_DICTIONARY
+
+	BASE_CLASS_IMPLEMENTED_METHODS_DICTIONARY=$WORKING_FOLDER/classes/dictionaries/$baseClassName"MethodsImplemented.txt"
+
+	if [ ! -z "$baseClassName" ] && [ -f "$BASE_CLASS_IMPLEMENTED_METHODS_DICTIONARY" ];
+	then
+		sed -e 's/^[A-Z][A-z0-9]*_/'"$className"'_/g' $BASE_CLASS_IMPLEMENTED_METHODS_DICTIONARY >> $CLASS_IMPLEMENTED_METHODS_DICTIONARY
+	fi
+
+	if [ ! -z "$implementedMethodNames" ];
+	then
+		sed -e 's/\(^.*\)/'"$className"'_\1 '"$className"'_\1/g' <<< "$implementedMethodNames" >> $CLASS_IMPLEMENTED_METHODS_DICTIONARY
+	fi
+
+	# The overrides come last, so they replace the base class' implementations
+	awk '{implementation[$1] = $2} END {for(method in implementation) print method" "implementation[method]}' $CLASS_IMPLEMENTED_METHODS_DICTIONARY > $CLASS_IMPLEMENTED_METHODS_DICTIONARY.tmp
+	mv $CLASS_IMPLEMENTED_METHODS_DICTIONARY.tmp $CLASS_IMPLEMENTED_METHODS_DICTIONARY
+fi
+
 echo "Cleaning owned methods dictionary on caller $CALLER"  >> $CLASS_LOG_FILE
 
 # Remove duplicates
@@ -771,6 +801,25 @@ do
 
 done <<< "$classModifiers"
 
+echo "Writing devirtualized methods dictionary on caller $CALLER"  >> $CLASS_LOG_FILE
+
+# Final classes cannot be inherited from, so the dynamic type of their instances is known
+# and calls to their virtual methods can be direct ones. Singletons are left out on purpose:
+# ClassName::mutateMethod patches their virtual tables at runtime (ie: Camera, VUEngine),
+# and direct calls would silently bypass the mutation. Classes marked final must not be the
+# target of mutateMethod.
+CLASS_DEVIRTUALIZED_METHODS_DICTIONARY=$WORKING_FOLDER/classes/dictionaries/$className"MethodsDevirtualized.txt"
+
+if [ ! "$isExtensionClass" = true ];
+then
+	rm -f $CLASS_DEVIRTUALIZED_METHODS_DICTIONARY
+
+	if [ ! "$isMutationClass" = true ] && [ "$isFinalClass" = true ];
+	then
+		awk 'NR == FNR {implementation[$1] = $2; next} ($1 in implementation) {print $1" "implementation[$1]}' $CLASS_IMPLEMENTED_METHODS_DICTIONARY $CLASS_VIRTUAL_METHODS_DICTIONARY > $CLASS_DEVIRTUALIZED_METHODS_DICTIONARY
+	fi
+fi
+
 # Add destructor declaration
 if [ ! "$isStaticClass" = true ] && [ ! "$isExtensionClass" = true ] && [ ! "$isMutationClass" = true ];
 then
@@ -331,8 +331,15 @@ then
 	rm -f $VIRTUAL_METHODS_FILE
 fi
 
+DEVIRTUALIZED_METHODS_FILE=$WORKING_FOLDER/classes/dictionaries/$fileName"MethodsDevirtualizedToApply.txt"
+if [ -f $DEVIRTUALIZED_METHODS_FILE ];
+then
+	rm -f $DEVIRTUALIZED_METHODS_FILE
+fi
+
 classHasNormalMethods=
 classHasVirtualMethods=
+classHasDevirtualizedMethods=
 
 #echo "referencedClassesNames $referencedClassesNames"
 
@@ -341,6 +348,7 @@ for referencedClassName in $referencedClassesNames
 do
 	REFERENCED_CLASS_NORMAL_METHODS_FILE=$WORKING_FOLDER/classes/dictionaries/$referencedClassName"MethodsOwned.txt"
 	REFERENCED_CLASS_VIRTUAL_METHODS_FILE=$WORKING_FOLDER/classes/dictionaries/$referencedClassName"MethodsVirtual.txt"
+	REFERENCED_CLASS_DEVIRTUALIZED_METHODS_FILE=$WORKING_FOLDER/classes/dictionaries/$referencedClassName"MethodsDevirtualized.txt"
 
 	referencedMethodNames=`grep "$referencedClassName" <<< "$methodCalls" | sed -e 's/::/_/g' | sed -e 's/$/\\\|/g' | tr -d "\r\n"`
 	referencedMethodNames=$referencedMethodNames"DUMMY_METHOD_NAME"
@@ -356,7 +364,16 @@ do
 	then
 
 		classHasVirtualMethods=true
-		grep -e "$referencedMethodNames" $REFERENCED_CLASS_VIRTUAL_METHODS_FILE >> $VIRTUAL_METHODS_FILE
+
+		if [ -s "$REFERENCED_CLASS_DEVIRTUALIZED_METHODS_FILE" ];
+		then
+			# The referenced class cannot be inherited from, call its methods' implementations directly
+			classHasDevirtualizedMethods=true
+			grep -e "$referencedMethodNames" $REFERENCED_CLASS_DEVIRTUALIZED_METHODS_FILE >> $DEVIRTUALIZED_METHODS_FILE
+			awk 'NR == FNR {devirtualized[$1]; next} !($1 in devirtualized)' $REFERENCED_CLASS_DEVIRTUALIZED_METHODS_FILE $REFERENCED_CLASS_VIRTUAL_METHODS_FILE | grep -e "$referencedMethodNames" >> $VIRTUAL_METHODS_FILE
+		else
+			grep -e "$referencedMethodNames" $REFERENCED_CLASS_VIRTUAL_METHODS_FILE >> $VIRTUAL_METHODS_FILE
+		fi
 	fi
 
 	#echo "."
@@ -391,6 +408,28 @@ then
 	fi
 fi
 
+DEVIRTUALIZATIONS_REPORT_FILE=$WORKING_FOLDER/classes/dictionaries/$fileName"Devirtualizations.txt"
+rm -f $DEVIRTUALIZATIONS_REPORT_FILE
+
+if [ -f "$DEVIRTUALIZED_METHODS_FILE" ];
+then
+	classHasDevirtualizedMethods=`sort -u $DEVIRTUALIZED_METHODS_FILE`
+	if [ ! -z "$classHasDevirtualizedMethods" ];
+	then
+		report=
+		if [ $PRINT_DEBUG_OUTPUT ];
+		then
+			report=$DEVIRTUALIZATIONS_REPORT_FILE
+		fi
+
+		echo "$classHasDevirtualizedMethods" > $DEVIRTUALIZED_METHODS_FILE
+		awk -v report="$report" -f $ENGINE_HOME/lib/compiler/preprocessor/devirtualizedMethodTraduction.awk $DEVIRTUALIZED_METHODS_FILE $OUTPUT_FILE > $OUTPUT_FILE.tmp
+		mv $OUTPUT_FILE.tmp $OUTPUT_FILE
+	fi
+
+	rm -f $DEVIRTUALIZED_METHODS_FILE
+fi
+
 if [ -f "$VIRTUAL_METHODS_FILE" ];
 then
 	classHasVirtualMethods=`cat $VIRTUAL_METHODS_FILE`
@@ -552,6 +591,14 @@ then
 	echo "" >> $WORKING_FOLDER/virtualizations.txt
 fi
 
+if [ -s "$DEVIRTUALIZATIONS_REPORT_FILE" ];
+then
+	echo "" >> $WORKING_FOLDER/devirtualizations.txt
+	echo "FILE: $INPUT_FILE ($(wc -l < $DEVIRTUALIZATIONS_REPORT_FILE | tr -d ' ') calls)" >> $WORKING_FOLDER/devirtualizations.txt
+	cat $DEVIRTUALIZATIONS_REPORT_FILE >> $WORKING_FOLDER/devirtualizations.txt
+	rm -f $DEVIRTUALIZATIONS_REPORT_FILE
+fi
+
 if [ ! -s $OUTPUT_FILE ];
 then
 	echo " error (10): could not processess file $OUTPUT_FILE"
@@ -0,0 +1,240 @@
+#!/bin/bash
+#
+# Ranks the most expensive actor specs and the actors that churn the most from a dump of the
+# streaming telemetry (see StreamingTelemetry::dump).
+#
+# Usage: analyzeStreamingTelemetry.sh -i DUMP_FILE [-s SYMBOLS_FILE] [-n ENTRIES]
+#
+# SYMBOLS_FILE is the output of "nm" over the game's elf file, used to print the specs' and
+# the positioned actors' names instead of their addresses.
+
+ENTRIES=10
+
+while [ $# -gt 1 ]
+do
+	key="$1"
+	case $key in
+		-i)
+		DUMP_FILE="$2"
+		shift # past argument
+		;;
+		-s)
+		SYMBOLS_FILE="$2"
+		shift # past argument
+		;;
+		-n)
+		ENTRIES="$2"
+		shift # past argument
+		;;
+	esac
+
+	shift
+done
+
+if [ -z "$DUMP_FILE" ] || [ ! -f "$DUMP_FILE" ]
+then
+	echo "Usage: $0 -i DUMP_FILE [-s SYMBOLS_FILE] [-n ENTRIES]"
+	exit 1
+fi
+
+if [ -z "$SYMBOLS_FILE" ] || [ ! -f "$SYMBOLS_FILE" ]
+then
+	SYMBOLS_FILE=/dev/null
+fi
+
+# Dump every byte as an unsigned decimal; the V810 is little endian
+od -An -v -t u1 "$DUMP_FILE" | tr -s ' ' '\n' | grep -v '^$' | awk -v entries="$ENTRIES" -v symbolsFile="$SYMBOLS_FILE" '
+function uint(offset, size,		value, i)
+{
+	value = 0;
+
+	for(i = size - 1; 0 <= i; i--)
+	{
+		value = value * 256 + bytes[offset + i];
+	}
+
+	return value;
+}
+
+function int16(offset,		value)
+{
+	value = uint(offset, 2);
+
+	return 32768 <= value ? value - 65536 : value;
+}
+
+function name(address)
+{
+	if(0 == address)
+	{
+		return "-";
+	}
+
+	address = sprintf("%08x", address);
+
+	return address in symbols ? symbols[address] : "0x" address;
+}
+
+# Print the keys of values sorted from highest to lowest
+function rank(title, header, values, lines, 		key, sortCommand)
+{
+	print "";
+	print title;
+	print header;
+
+	sortCommand = "sort -t \"\t\" -k1,1 -n -r | head -n " entries " | cut -f 2-";
+
+	for(key in values)
+	{
+		print values[key] "\t" lines[key] | sortCommand;
+	}
+
+	close(sortCommand);
+}
+
+BEGIN {
+	# nm lines: address type symbol
+	while(0 < (getline line < symbolsFile))
+	{
+		if(3 <= split(line, fields, " "))
+		{
+			symbols[tolower(fields[1])] = fields[3];
+		}
+	}
+}
+
+{
+	bytes[totalBytes++] = $1;
+}
+
+END {
+	if(16 > totalBytes || 1414747478 != uint(0, 4))
+	{
+		print "Not a streaming telemetry dump";
+		exit 1;
+	}
+
+	tickDurationUS = uint(4, 2);
+	records = uint(6, 2);
+	droppedRecords = uint(8, 4);
+	frames = uint(12, 4);
+
+	split("load unload purge factory frame", eventNames, " ");
+
+	for(i = 0; i < records && 16 + (i + 1) * 20 <= totalBytes; i++)
+	{
+		offset = 16 + i * 20;
+
+		positionedActor = uint(offset, 4);
+		actorSpec = uint(offset + 4, 4);
+		frame = uint(offset + 8, 4);
+		ticks = uint(offset + 12, 2);
+		internalId = int16(offset + 14);
+		event = bytes[offset + 16] + 1;
+		phase = bytes[offset + 17];
+
+		if("frame" == eventNames[event])
+		{
+			streamingFrames++;
+			phaseFrames[phase]++;
+
+			if(highestFrameTicks < ticks)
+			{
+				highestFrameTicks = ticks;
+				highestFrame = frame;
+			}
+
+			totalFrameTicks += ticks;
+			continue;
+		}
+
+		eventCount[event]++;
+		eventTicks[event] += ticks;
+
+		if(0 != actorSpec)
+		{
+			specTicks[actorSpec] += ticks;
+			specCount[actorSpec]++;
+
+			if(specHighestTicks[actorSpec] < ticks)
+			{
+				specHighestTicks[actorSpec] = ticks;
+			}
+		}
+
+		if(0 != positionedActor)
+		{
+			if("load" == eventNames[event])
+			{
+				loads[positionedActor]++;
+
+				# Only the loads that follow an unload of the same actor are wasted round trips
+				if(positionedActor in unloadFrame)
+				{
+					reloads[positionedActor]++;
+					gap = frame - unloadFrame[positionedActor];
+
+					if(!(positionedActor in shortestGap) || gap < shortestGap[positionedActor])
+					{
+						shortestGap[positionedActor] = gap;
+					}
+				}
+			}
+			else if("unload" == eventNames[event])
+			{
+				unloads[positionedActor]++;
+				unloadFrame[positionedActor] = frame;
+			}
+
+			actorSpecs[positionedActor] = actorSpec;
+		}
+	}
+
+	print "Records:        " records " (" droppedRecords " dropped)";
+	print "Frames:         " frames " (" streamingFrames " streaming)";
+	print "Tick (us):      " tickDurationUS;
+
+	if(0 < streamingFrames)
+	{
+		print "Average (us):   " int(totalFrameTicks * tickDurationUS / streamingFrames);
+		print "Worst (us):     " highestFrameTicks * tickDurationUS " (frame " highestFrame ")";
+	}
+
+	print "";
+	printf "%-10s %8s %12s\n", "EVENT", "COUNT", "TOTAL (us)";
+
+	for(event = 1; event <= 4; event++)
+	{
+		printf "%-10s %8d %12d\n", eventNames[event], eventCount[event], eventTicks[event] * tickDurationUS;
+	}
+
+	print "";
+	printf "%-10s %8s\n", "END PHASE", "FRAMES";
+
+	for(phase in phaseFrames)
+	{
+		printf "%-10d %8d\n", phase, phaseFrames[phase];
+	}
+
+	for(actorSpec in specTicks)
+	{
+		specLines[actorSpec] = sprintf("%-32s %8d %12d %10d", name(actorSpec), specCount[actorSpec],
+			specTicks[actorSpec] * tickDurationUS, specHighestTicks[actorSpec] * tickDurationUS);
+	}
+
+	rank("MOST EXPENSIVE SPECS", sprintf("%-32s %8s %12s %10s", "SPEC", "EVENTS", "TOTAL (us)", "MAX (us)"),
+		specTicks, specLines);
+
+	for(positionedActor in reloads)
+	{
+		churn[positionedActor] = reloads[positionedActor];
+		churnLines[positionedActor] = sprintf("%-32s %-24s %6d %8d %8d %10d", name(positionedActor),
+			name(actorSpecs[positionedActor]), loads[positionedActor], unloads[positionedActor],
+			reloads[positionedActor], shortestGap[positionedActor]);
+	}
+
+	rank("CHURNING ACTORS",
+		sprintf("%-32s %-24s %6s %8s %8s %10s", "POSITIONED ACTOR", "SPEC", "LOADS", "UNLOADS", "RELOADS", "MIN GAP"),
+		churn, churnLines);
+}
+'
@@ -378,6 +378,13 @@ void Camera::stopEffect(int32 effect)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+void Camera::updateEffects()
+{
+	CameraEffectManager::update(this->cameraEffectManager);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 #ifndef __SHIPPING
 void Camera::print(int32 x, int32 y, bool inPixels)
 {	
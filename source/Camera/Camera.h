@@ -210,6 +210,9 @@ singleton class Camera : ListenerObject
 	/// @param effect: Code of the effect to stop
 	void stopEffect(int32 effect);
 
+	/// Update the camera effects that are in progress.
+	void updateEffects();
+
 	/// Print the camera's status.
 	/// @param x: Screen x coordinate where to print
 	/// @param y: Screen y coordinate where to print
@@ -14,9 +14,8 @@
 #include <Camera.h>
 #include <DebugConfig.h>
 #include <GameState.h>
+#include <Hardware.h>
 #include <Singleton.h>
-#include <Telegram.h>
-#include <Timer.h>
 #include <DisplayUnit.h>
 #include <VUEngine.h>
 
@@ -40,10 +39,13 @@ void CameraEffectManager::constructor()
 	Base::constructor();
 
 	// Init class variables
-	this->fadeDelay = 0;
+	this->fadeFramesPerStep = 1;
+	this->fadeFrameCountdown = 0;
 	this->fadeScope = NULL;
 	this->fadeEffectIncrement = __CAMERA_EFFECT_FADE_INCREMENT;
 	this->startingANewEffect = false;
+	this->fading = false;
+	this->fadeCompleted = false;
 	this->targetDisplayColorConfig = DisplayUnit::getColorConfig();
 }
 
@@ -60,18 +62,40 @@ void CameraEffectManager::destructor()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-bool CameraEffectManager::handleMessage(Telegram telegram)
+bool CameraEffectManager::onEvent(ListenerObject eventFirer __attribute__((unused)), uint16 eventCode)
 {
-	switch(Telegram::getMessage(telegram))
+	switch(eventCode)
 	{
-		case kFadeTo:
-		{				
-			CameraEffectManager::fadeAsync(this);
-			break;
-		}	
+		case kEventDisplayUnitFrameStart:
+		{
+			if(!this->fading)
+			{
+				return false;
+			}
+
+			if(0 < this->fadeFrameCountdown)
+			{
+				this->fadeFrameCountdown--;
+				return true;
+			}
+
+			this->fadeFrameCountdown = this->fadeFramesPerStep - 1;
+
+			if(DisplayUnit::modifyBrightness(this->fadeEffectIncrement, this->targetDisplayColorConfig))
+			{
+				// The events are not fired here since their listeners could change the game state
+				// while the VIP's interrupt is being serviced
+				this->fading = false;
+				this->fadeCompleted = true;
+
+				return false;
+			}
+
+			return true;
+		}
 	}
 
-	return true;
+	return Base::onEvent(this, eventFirer, eventCode);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -85,6 +109,29 @@ void CameraEffectManager::reset()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+void CameraEffectManager::update()
+{
+	if(!this->fadeCompleted)
+	{
+		return;
+	}
+
+	this->fadeCompleted = false;
+	this->startingANewEffect = false;
+
+	// Fire effect ended event
+	CameraEffectManager::fireEvent(this, kEventEffectFadeInComplete);
+	CameraEffectManager::fireEvent(this, kEventEffectFadeOutComplete);
+
+	if(!this->startingANewEffect)
+	{
+		CameraEffectManager::removeEventListeners(this, NULL, kEventEffectFadeInComplete);
+		CameraEffectManager::removeEventListeners(this, NULL, kEventEffectFadeOutComplete);
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void CameraEffectManager::setFadeIncrement(uint8 fadeEffectIncrement)
 {
 	this->fadeEffectIncrement = fadeEffectIncrement;
@@ -153,28 +200,10 @@ void CameraEffectManager::stopEffect(int32 effect)
 
 void CameraEffectManager::fadeStart(int32 effect, int32 delay)
 {
-	switch(effect)
-	{
-		case kFadeIn:
-		{
-			while(DisplayUnit::upBrightness(__ABS(this->fadeEffectIncrement)))
-			{
-				Timer::wait(delay);
-			};
-			
-			break;
-		}
+	DisplayColorConfig targetDisplayColorConfig = 
+		kFadeIn == effect ? DisplayUnit::getColorConfig() : DisplayUnit::getDarkColorConfig();
 
-		case kFadeOut:
-		{
-			while(DisplayUnit::lowerBrightness(-__ABS(this->fadeEffectIncrement)))
-			{
-				Timer::wait(delay);
-			};
-			
-			break;
-		}
-	}
+	CameraEffectManager::fadeAsyncStart(this, 0, &targetDisplayColorConfig, delay, NULL);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -199,8 +228,8 @@ void CameraEffectManager::fadeAsyncStart
 		this->targetDisplayColorConfig = *targetDisplayColorConfig;
 	}
 
-	// Set effect parameters
-	this->fadeDelay = (0 >= delayBetweenSteps) ? 1 : (uint8)(delayBetweenSteps);
+	// Precompute the ramp's pacing in VIP frames so the VIP's frame start only has to count down
+	this->fadeFramesPerStep = CameraEffectManager::millisecondsToFrames(delayBetweenSteps);
 
 	if(scope != NULL)
 	{
@@ -219,9 +248,15 @@ void CameraEffectManager::fadeAsyncStart
 	}
 	
 	// Start effect
-	// TODO: check if the message really needs to be delayed.
-	initialDelay = 0 >= initialDelay ? 1 : initialDelay;
-	CameraEffectManager::sendMessageToSelf(this, kFadeTo, initialDelay, 0);
+	Hardware::suspendInterrupts();
+
+	this->fadeFrameCountdown = 0 >= initialDelay ? 0 : CameraEffectManager::millisecondsToFrames(initialDelay);
+	this->fadeCompleted = false;
+	this->fading = true;
+
+	DisplayUnit::addEventListener(DisplayUnit::getInstance(), ListenerObject::safeCast(this), kEventDisplayUnitFrameStart);
+
+	Hardware::resumeInterrupts();
 
 	// Fire effect started event
 	CameraEffectManager::fireEvent(this, kEventEffectFadeStart);
@@ -232,15 +267,23 @@ void CameraEffectManager::fadeAsyncStart
 
 void CameraEffectManager::fadeAsyncStop()
 {
+	// Stop stepping the brightness
+	Hardware::suspendInterrupts();
+
+	this->fading = false;
+	this->fadeCompleted = false;
+
+	DisplayUnit::removeEventListener(DisplayUnit::getInstance(), ListenerObject::safeCast(this), kEventDisplayUnitFrameStart);
+
+	Hardware::resumeInterrupts();
+
 	// Remove event listener
 	CameraEffectManager::removeEventListeners(this, NULL, kEventEffectFadeInComplete);
 	CameraEffectManager::removeEventListeners(this, NULL, kEventEffectFadeOutComplete);
 
-	// Discard pending delayed messages to stop effect
-	CameraEffectManager::discardMessages(this, kFadeTo);
-
 	// Reset effect variables
-	this->fadeDelay = 0;
+	this->fadeFramesPerStep = 1;
+	this->fadeFrameCountdown = 0;
 	this->fadeScope = NULL;
 
 	// Fire effect stopped event
@@ -250,28 +293,11 @@ void CameraEffectManager::fadeAsyncStop()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-void CameraEffectManager::fadeAsync()
+uint16 CameraEffectManager::millisecondsToFrames(int32 milliseconds)
 {
-	ASSERT(this, "CameraEffectManager::fadeAsync: invalid this");
-
-	if(DisplayUnit::modifyBrightness(this->fadeEffectIncrement, this->targetDisplayColorConfig))
-	{
-		this->startingANewEffect = false;
-
-		// Fire effect ended event
-		CameraEffectManager::fireEvent(this, kEventEffectFadeInComplete);
-		CameraEffectManager::fireEvent(this, kEventEffectFadeOutComplete);
+	int32 frames = milliseconds / (__MILLISECONDS_PER_SECOND / __MAXIMUM_FPS);
 
-		if(!this->startingANewEffect)
-		{
-			CameraEffectManager::removeEventListeners(this, NULL, kEventEffectFadeInComplete);
-			CameraEffectManager::removeEventListeners(this, NULL, kEventEffectFadeOutComplete);
-		}
-	}
-	else
-	{
-		CameraEffectManager::sendMessageToSelf(this, kFadeTo, this->fadeDelay, 0);
-	}
+	return 0 >= frames ? 1 : (uint16)frames;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -22,7 +22,6 @@
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 class Actor;
-class Telegram;
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DATA
@@ -48,6 +47,8 @@ enum CameraFX
 /// Inherits from ListenerObject
 ///
 /// Manages camera's special effects, brightness transitions, etc.
+/// Fades advance one brightness step per VIP frame without blocking the game loop, so the
+/// stage can keep streaming while the screen fades.
 singleton class CameraEffectManager : ListenerObject
 {
 	/// Target color config
@@ -56,8 +57,11 @@ singleton class CameraEffectManager : ListenerObject
 	/// Callback scope for the current fade effect
 	ListenerObject fadeScope;
 
-	/// Delay for the current fade effect
-	uint8 fadeDelay;
+	/// Number of VIP frames between brightness steps of the current fade effect
+	uint16 fadeFramesPerStep;
+
+	/// VIP frames left before the next brightness step
+	uint16 fadeFrameCountdown;
 
 	/// Fade increment
 	uint8 fadeEffectIncrement;
@@ -65,19 +69,30 @@ singleton class CameraEffectManager : ListenerObject
 	/// Flag to signal that the current event listener has to be removed when the effect is complete
 	bool startingANewEffect;
 
+	/// Flag raised while the manager listens for the VIP's frame starts to step the current fade effect
+	bool fading;
+
+	/// Flag raised in the VIP's frame start when the target brightness has been reached, the
+	/// completion events are fired from the game loop by the next call to update
+	volatile bool fadeCompleted;
+
 	/// @publicsection
 	
 	/// Class' constructor
 	void constructor();
 
-	/// Receive and process a Telegram.
-	/// @param telegram: Received telegram to process
-	/// @return True if the telegram was processed
-	override bool handleMessage(Telegram telegram);
+	/// Process an event that the instance is listening for.
+	/// @param eventFirer: ListenerObject that signals the event
+	/// @param eventCode: Code of the firing event
+	/// @return False if the listener has to be removed; true to keep it
+	override bool onEvent(ListenerObject eventFirer, uint16 eventCode);
 
 	/// Reset the manager's state
 	void reset();
 
+	/// Fire the completion events of a fade effect that has reached its target brightness.
+	void update();
+
 	/// Set the fade increment to apply on the next effect.
 	/// @param fadeEffectIncrement: Fade increment
 	void setFadeIncrement(uint8 fadeEffectIncrement);
@@ -25,6 +25,9 @@ void Behavior::constructor(Entity owner, const BehaviorSpec* behaviorSpec)
 	Base::constructor(owner, (const ComponentSpec*)&behaviorSpec->componentSpec);
 
 	this->enabled = behaviorSpec->enabled;
+	this->updateSchedule.policy = behaviorSpec->updatePolicy;
+	this->updateSchedule.interval = 1 < behaviorSpec->updateInterval ? behaviorSpec->updateInterval : 1;
+	this->updateSchedule.framesUntilUpdate = 0;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -57,3 +60,15 @@ bool Behavior::isEnabled()
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+uint8 Behavior::getUpdatePolicy()
+{
+	return this->updateSchedule.policy;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Behavior::update()
+{}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
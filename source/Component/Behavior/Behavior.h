@@ -30,6 +30,12 @@ typedef struct BehaviorSpec
 	/// Enabled?
 	bool enabled;
 
+	/// How often the behavior is updated (ComponentUpdatePolicies)
+	uint8 updatePolicy;
+
+	/// Game frames between updates when the policy is kComponentUpdateEveryNthFrame
+	uint8 updateInterval;
+
 } BehaviorSpec;
 
 /// A Behavior spec that is stored in ROM
@@ -53,6 +59,9 @@ class Behavior : Component
 	/// Flag to allow or prohibit the behavior to perform its operations
 	bool enabled;
 
+	/// Schedule that determines when the behavior is updated
+	ComponentUpdateSchedule updateSchedule;
+
 	/// @publicsection
 
 	/// Class' constructor
@@ -69,6 +78,13 @@ class Behavior : Component
 	/// Check if the behavior's operations are enabled.
 	/// @return True if the behavior's operations are enabled; false otherwise
 	bool isEnabled();
+
+	/// Retrieve the behavior's update policy.
+	/// @return Update policy (ComponentUpdatePolicies)
+	uint8 getUpdatePolicy();
+
+	/// Perform the behavior's operations. Called by the manager according to the update policy.
+	virtual void update();
 }
 
 #endif
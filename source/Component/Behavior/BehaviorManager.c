@@ -58,13 +58,23 @@ Behavior BehaviorManager::create(Entity owner, const BehaviorSpec* behaviorSpec)
 		return NULL;
 	}
 
-	return ((Behavior (*)(Entity, const BehaviorSpec*)) ((ComponentSpec*)behaviorSpec)->allocator)(owner, behaviorSpec);
+	Behavior behavior = ((Behavior (*)(Entity, const BehaviorSpec*)) ((ComponentSpec*)behaviorSpec)->allocator)(owner, behaviorSpec);
+
+	if(!isDeleted(behavior))
+	{
+		ComponentManager::scheduleUpdates(this, &behavior->updateSchedule);
+	}
+
+	return behavior;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 void BehaviorManager::update()
 {
+	this->updatedComponents = 0;
+	this->enabledComponents = 0;
+
 	for(VirtualNode node = this->components->head, nextNode = NULL; NULL != node; node = nextNode)
 	{
 		nextNode = node->next;
@@ -80,6 +90,22 @@ void BehaviorManager::update()
 			delete behavior;
 			continue;
 		}
+
+		if(!behavior->enabled)
+		{
+			continue;
+		}
+
+		this->enabledComponents++;
+
+		if(!ComponentManager::isDue(this, &behavior->updateSchedule, Component::safeCast(behavior)))
+		{
+			continue;
+		}
+
+		Behavior::update(behavior);
+
+		this->updatedComponents++;
 	}
 }
 
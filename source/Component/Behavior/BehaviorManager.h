@@ -29,8 +29,6 @@
 /// Manages all the behavior instances.
 class BehaviorManager : ComponentManager
 {
-	/// @protectedsection
-
 	/// @publicsection
 
 	/// Class' constructor
@@ -56,7 +54,7 @@ class BehaviorManager : ComponentManager
 	/// Reset the manager's state
 	void reset();
 
-	/// Update the registered bodies by advancing the physics simulations.
+	/// Update the registered behaviors according to their update policies.
 	void update();
 }
 
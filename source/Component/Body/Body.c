@@ -71,10 +71,17 @@ typedef struct NormalRegistry
 	Vector3D direction;
 	fixed_t magnitude;
 
+	/// Surrounding friction coefficient provided when the contact was registered
+	fixed_t frictionCoefficient;
+
+	/// False while the body moves away from the referent
+	bool active;
+
 } NormalRegistry;
 
 static Vector3D _gravity = {0, 0, 0};
 static fixed_t _frictionCoefficient = 0;
+static fix7_9_ext _elapsedTimeStep = __PHYSICS_TIME_ELAPSED_STEP;
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' PUBLIC STATIC METHODS
@@ -96,9 +103,16 @@ static void Body::setGlobalFrictionCoefficient(fixed_t frictionCoefficient)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+static void Body::setGlobalElapsedTimeStep(fix7_9_ext elapsedTimeStep)
+{
+	_elapsedTimeStep = elapsedTimeStep;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 static fixed_t Body::getElapsedTimeStep()
 {
-	return __PHYSICS_TIME_ELAPSED_STEP;
+	return _elapsedTimeStep;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -162,6 +176,8 @@ void Body::constructor(Entity owner, const BodySpec* bodySpec)
 
 	this->awake = false;
 	this->sendMessages = true;
+	this->interpolated = false;
+	this->stepped = false;
 	this->axisSubjectToGravity = bodySpec->axisSubjectToGravity;
 	this->axisForSynchronizationWithBody = bodySpec->axisForSynchronizationWithBody;
 
@@ -171,6 +187,8 @@ void Body::constructor(Entity owner, const BodySpec* bodySpec)
 	this->movementType.z = __NO_MOVEMENT;
 
 	this->position 				= Vector3D::zero();
+	this->previousPosition		= Vector3D::zero();
+	this->interpolatedPosition	= Vector3D::zero();
 	this->velocity 				= Vector3D::zero();
 	this->direction 			= Vector3D::zero();
 	this->accelerating 			= (Vector3DFlag){false, false, false};
@@ -290,6 +308,9 @@ void Body::clearNormal(ListenerObject referent)
 
 void Body::update(uint16 cycle, fix7_9_ext elapsedTime)
 {
+	this->interpolated = false;
+	this->stepped = false;
+
 	if(!this->awake)
 	{
 		return;
@@ -297,53 +318,73 @@ void Body::update(uint16 cycle, fix7_9_ext elapsedTime)
 	
 	MovementResult movementResult;
 
-	if(0 != this->skipCycles)
+	if(!Body::integrate(this, cycle, elapsedTime, &movementResult))
 	{
-		if(0 < this->skipCycles)
-		{
-			if(this->skipCycles > this->skipedCycles++)
-			{
-				return;
-			}
-
-			this->skipedCycles = 0;
-
-			movementResult = Body::updateMovement(this, cycle, elapsedTime);
-		}
-		else if(0 > this->skipCycles)
-		{
-			this->skipedCycles = 0;
-
-			while(this->skipCycles <= this->skipedCycles--)
-			{
-				movementResult = Body::updateMovement(this, cycle, elapsedTime);
-			}
-		}
+		return;
 	}
-	else
+
+	if(!isDeleted(this->owner))
 	{
-		movementResult = Body::updateMovement(this, cycle, elapsedTime);
+		Entity::setPosition(this->owner, &this->position);
+		Entity::setDirection(this->owner, &this->direction);
 	}
 
-	if(!isDeleted(this->owner))
+	Body::processMovementResult(this, movementResult);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Body::step(uint16 cycle, fix7_9_ext elapsedTime)
+{
+	this->previousPosition = this->position;
+
+	MovementResult movementResult;
+
+	bool moved = this->awake && Body::integrate(this, cycle, elapsedTime, &movementResult);
+
+	// Collisions are processed after each fixed time step, so the owner cannot be left behind at the
+	// interpolated position
+	if((moved || this->interpolated) && !isDeleted(this->owner))
 	{
 		Entity::setPosition(this->owner, &this->position);
 		Entity::setDirection(this->owner, &this->direction);
 	}
 
-	// If stopped on any axis
-	if(0 != movementResult.axisStoppedMovement)
+	this->interpolated = false;
+	this->stepped = true;
+
+	if(moved)
 	{
-		Body::stopMovement(this, movementResult.axisStoppedMovement);
+		Body::processMovementResult(this, movementResult);
+	}
+}
 
-		if(!isDeleted(this->owner) && 0 != movementResult.axisStoppedMovement && this->sendMessages)
-		{
-			Body::sendMessageTo(this, ListenerObject::safeCast(this->owner), kMessageBodyStopped, 0, 0);
-		}
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Body::interpolate(fixed_t alpha)
+{
+	Vector3D interpolatedPosition = 
+	{
+		this->previousPosition.x + __FIXED_MULT(this->position.x - this->previousPosition.x, alpha),
+		this->previousPosition.y + __FIXED_MULT(this->position.y - this->previousPosition.y, alpha),
+		this->previousPosition.z + __FIXED_MULT(this->position.z - this->previousPosition.z, alpha),
+	};
+
+	// The owner may have been placed at the physical position by a fixed time step since the last time
+	if(this->interpolated && Vector3D::areEqual(interpolatedPosition, this->interpolatedPosition))
+	{
+		return;
 	}
 
-	// Clear any force so the next update does not get influenced
-	Body::clearExternalForce(this);
+	this->interpolated = true;
+	this->stepped = false;
+	this->interpolatedPosition = interpolatedPosition;
+
+	if(!isDeleted(this->owner))
+	{
+		Entity::setPosition(this->owner, &this->interpolatedPosition);
+		Entity::setDirection(this->owner, &this->direction);
+	}
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -390,20 +431,23 @@ uint8 Body::applyForce(const Vector3D* force)
 
 void Body::bounce(ListenerObject bounceReferent, Vector3D bouncingPlaneNormal, fixed_t frictionCoefficient, fixed_t bounciness)
 {
-	Body::setSurroundingFrictionCoefficient(this, frictionCoefficient);
+	NormalRegistry* normalRegistry = Body::getRestingContact(this, bounceReferent, bouncingPlaneNormal);
 
-	fixed_t cosAngle = 
-		__I_TO_FIXED(bouncingPlaneNormal.x | bouncingPlaneNormal.y | bouncingPlaneNormal.z) 
-		&& 
-		(this->gravity.x | this->gravity.y | this->gravity.z) ? 
-			__ABS(__FIXED_EXT_DIV(Vector3D::dotProduct(this->gravity, bouncingPlaneNormal), 
-			Vector3D::lengthProduct(this->gravity, bouncingPlaneNormal))) 
-			: 
-			__1I_FIXED;
+	if(NULL == normalRegistry)
+	{
+		Body::setSurroundingFrictionCoefficient(this, frictionCoefficient);
 
-	fixed_t normalMagnitude = __FIXED_EXT_MULT(Vector3D::length(Body::getWeight(this)), cosAngle);
+		fixed_t normalMagnitude = Body::computeNormalMagnitude(this, bouncingPlaneNormal);
 
-	Body::addNormal(this, bounceReferent, bouncingPlaneNormal, normalMagnitude);
+		normalRegistry = Body::registerNormal(this, bounceReferent, bouncingPlaneNormal, normalMagnitude);
+		normalRegistry->frictionCoefficient = frictionCoefficient;
+	}
+	else if(normalRegistry->frictionCoefficient != frictionCoefficient)
+	{
+		// The body rests on the referent, only the friction has to be refreshed
+		Body::setSurroundingFrictionCoefficient(this, frictionCoefficient);
+		normalRegistry->frictionCoefficient = frictionCoefficient;
+	}
 
 	if(0 < this->bounciness)
 	{
@@ -634,6 +678,9 @@ void Body::setAxisSubjectToGravity(uint16 axisSubjectToGravity)
 	this->axisSubjectToGravity = axisSubjectToGravity;
 
 	this->gravity = Body::getGravity(this);
+
+	// The normals that the body rests on depend on its weight
+	Body::refreshNormalMagnitudes(this);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -709,6 +756,9 @@ fixed_t Body::getFrictionCoefficient()
 void Body::setMass(fixed_t mass)
 {
 	this->mass = __BODY_MIN_MASS < mass ? __BODY_MAX_MASS > mass ? mass : __BODY_MAX_MASS : __BODY_MIN_MASS;
+
+	// The normals that the body rests on depend on its weight
+	Body::refreshNormalMagnitudes(this);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -724,7 +774,24 @@ void Body::setPosition(const Vector3D* position, Entity caller)
 {
 	if(this->owner == caller)
 	{
-		this->position = *position;
+		if(this->interpolated || this->stepped)
+		{
+			// The owner sits at the interpolated position or at the physical one of a fixed time step, so 
+			// moving it, like when a collision is resolved, displaces the physical state instead of 
+			// discarding the last step's progress
+			Vector3D displacement = 
+				Vector3D::sub(*position, this->interpolated ? this->interpolatedPosition : this->position);
+
+			this->position = Vector3D::sum(this->position, displacement);
+			this->previousPosition = Vector3D::sum(this->previousPosition, displacement);
+			this->interpolatedPosition = Vector3D::sum(this->interpolatedPosition, displacement);
+		}
+		else
+		{
+			this->position = *position;
+			this->previousPosition = *position;
+			this->interpolatedPosition = *position;
+		}
 
 		this->internalPosition.x = __FIXED_TO_FIX7_9_EXT(this->position.x);
 		this->internalPosition.y = __FIXED_TO_FIX7_9_EXT(this->position.y);
@@ -741,6 +808,13 @@ const Vector3D* Body::getPosition()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+const Vector3D* Body::getInterpolatedPosition()
+{
+	return &this->interpolatedPosition;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void Body::setMaximumVelocity(Vector3D maximumVelocity)
 {
 	this->maximumVelocity = maximumVelocity;
@@ -1155,7 +1229,8 @@ void Body::computeDirectionAndSpeed(bool useExternalForceForDirection)
 
 		this->direction = Vector3D::scalarDivision(this->velocity, this->speed);
 #else
-		fix7_9_ext speed = __F_TO_FIX7_9_EXT(Math::squareRoot(__FIXED_EXT_TO_F(Vector3D::squareLength(this->velocity))));
+		// The square length has __FIXED_TO_I_BITS fractional bits, the speed needs 9
+		fix7_9_ext speed = (fix7_9_ext)Math::squareRootInteger((uint32)Vector3D::squareLength(this->velocity), 18 - __FIXED_TO_I_BITS);
 
 		this->speed = __FIX7_9_EXT_TO_FIXED(speed);
 
@@ -1224,6 +1299,60 @@ void Body::clampVelocity(bool useExternalForceForDirection)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+bool Body::integrate(uint16 cycle, fix7_9_ext elapsedTime, MovementResult* movementResult)
+{
+	if(0 != this->skipCycles)
+	{
+		if(0 < this->skipCycles)
+		{
+			if(this->skipCycles > this->skipedCycles++)
+			{
+				return false;
+			}
+
+			this->skipedCycles = 0;
+
+			*movementResult = Body::updateMovement(this, cycle, elapsedTime);
+		}
+		else if(0 > this->skipCycles)
+		{
+			this->skipedCycles = 0;
+
+			while(this->skipCycles <= this->skipedCycles--)
+			{
+				*movementResult = Body::updateMovement(this, cycle, elapsedTime);
+			}
+		}
+	}
+	else
+	{
+		*movementResult = Body::updateMovement(this, cycle, elapsedTime);
+	}
+
+	return true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Body::processMovementResult(MovementResult movementResult)
+{
+	// If stopped on any axis
+	if(0 != movementResult.axisStoppedMovement)
+	{
+		Body::stopMovement(this, movementResult.axisStoppedMovement);
+
+		if(!isDeleted(this->owner) && 0 != movementResult.axisStoppedMovement && this->sendMessages)
+		{
+			Body::sendMessageTo(this, ListenerObject::safeCast(this->owner), kMessageBodyStopped, 0, 0);
+		}
+	}
+
+	// Clear any force so the next update does not get influenced
+	Body::clearExternalForce(this);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 MovementResult Body::updateMovement(uint16 cycle, fix7_9_ext elapsedTime)
 {
 	this->friction = Vector3D::scalarProduct(this->direction, -this->frictionForceMagnitude);
@@ -1362,6 +1491,30 @@ void Body::awake(uint16 axisOfAwakening)
 void Body::sleep()
 {
 	this->awake = false;
+
+	// Contacts that were detached when the body was awaken and that
+	// it didn't land on again are not going to be reused
+	if(!isDeleted(this->normals))
+	{
+		for(VirtualNode node = this->normals->head, nextNode = NULL; NULL != node; node = nextNode)
+		{
+			nextNode = node->next;
+
+			NormalRegistry* normalRegistry = (NormalRegistry*)node->data;
+
+			if(!normalRegistry->active || isDeleted(normalRegistry->referent))
+			{
+				VirtualList::removeNode(this->normals, node);
+				delete normalRegistry;
+			}
+		}
+
+		if(NULL == this->normals->head)
+		{
+			delete this->normals;
+			this->normals = NULL;
+		}
+	}
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -1378,7 +1531,7 @@ void Body::computeTotalNormal()
 		{
 			NormalRegistry* normalRegistry = (NormalRegistry*)node->data;
 
-			if(!isDeleted(normalRegistry->referent))
+			if(normalRegistry->active && !isDeleted(normalRegistry->referent))
 			{
 				Vector3D normal = Vector3D::scalarProduct(normalRegistry->direction, normalRegistry->magnitude);
 
@@ -1400,32 +1553,186 @@ void Body::computeTotalNormal()
 
 void Body::addNormal(ListenerObject referent, Vector3D direction, fixed_t magnitude)
 {
-	ASSERT(referent, "Body::addNormal: null referent");
+	Body::registerNormal(this, referent, direction, magnitude);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+NormalRegistry* Body::registerNormal(ListenerObject referent, Vector3D direction, fixed_t magnitude)
+{
+	ASSERT(referent, "Body::registerNormal: null referent");
+
+	NormalRegistry* normalRegistry = Body::findNormalRegistry(this, referent);
+
+	if(NULL == normalRegistry)
+	{
+		if(NULL == this->normals)
+		{
+			this->normals = new VirtualList();
+		}
+
+		// Recycle a contact cached for a referent that the body didn't land on again
+		normalRegistry = Body::findInactiveNormalRegistry(this);
+
+		if(NULL == normalRegistry)
+		{
+			normalRegistry = new NormalRegistry;
+
+			VirtualList::pushBack(this->normals, normalRegistry);
+		}
+
+		normalRegistry->referent = referent;
+		normalRegistry->frictionCoefficient = 0;
+		normalRegistry->active = false;
+	}
+	else if
+	(
+		normalRegistry->active 
+		&& 
+		normalRegistry->magnitude == magnitude 
+		&& 
+		normalRegistry->direction.x == direction.x 
+		&& 
+		normalRegistry->direction.y == direction.y 
+		&& 
+		normalRegistry->direction.z == direction.z
+	)
+	{
+		// Nothing changed, the total normal is still valid
+		return normalRegistry;
+	}
+
+	normalRegistry->direction = direction;
+	normalRegistry->magnitude = magnitude;
+	normalRegistry->active = true;
+
+	Body::computeTotalNormal(this);
+
+	return normalRegistry;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+NormalRegistry* Body::findNormalRegistry(ListenerObject referent)
+{
 	if(NULL == this->normals)
 	{
-		this->normals = new VirtualList();
+		return NULL;
 	}
 
-#ifndef __RELEASE
 	for(VirtualNode node = this->normals->head; NULL != node; node = node->next)
 	{
-		ASSERT(!isDeleted(node->data), "Body::addNormal: null normal");
+		ASSERT(!isDeleted(node->data), "Body::findNormalRegistry: null normal");
+
+		NormalRegistry* normalRegistry = (NormalRegistry*)node->data;
+
+		if(normalRegistry->referent == referent)
+		{
+			return normalRegistry;
+		}
 	}
-#endif
 
-	NormalRegistry* normalRegistry = new NormalRegistry;
-	normalRegistry->referent = referent;
-	normalRegistry->direction = direction;
-	normalRegistry->magnitude = magnitude;
+	return NULL;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-	VirtualList::pushBack(this->normals, normalRegistry);
+NormalRegistry* Body::findInactiveNormalRegistry()
+{
+	if(NULL == this->normals)
+	{
+		return NULL;
+	}
+
+	for(VirtualNode node = this->normals->head; NULL != node; node = node->next)
+	{
+		NormalRegistry* normalRegistry = (NormalRegistry*)node->data;
+
+		if(!normalRegistry->active || isDeleted(normalRegistry->referent))
+		{
+			return normalRegistry;
+		}
+	}
+
+	return NULL;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+fixed_t Body::computeNormalMagnitude(Vector3D direction)
+{
+	fixed_t cosAngle = 
+		__I_TO_FIXED(direction.x | direction.y | direction.z) 
+		&& 
+		(this->gravity.x | this->gravity.y | this->gravity.z) ? 
+			__ABS(__FIXED_EXT_DIV(Vector3D::dotProduct(this->gravity, direction), 
+			Vector3D::lengthProduct(this->gravity, direction))) 
+			: 
+			__1I_FIXED;
+
+	return __FIXED_EXT_MULT(Vector3D::length(Body::getWeight(this)), cosAngle);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Body::refreshNormalMagnitudes()
+{
+	if(isDeleted(this->normals))
+	{
+		return;
+	}
+
+	for(VirtualNode node = this->normals->head; NULL != node; node = node->next)
+	{
+		NormalRegistry* normalRegistry = (NormalRegistry*)node->data;
+
+		normalRegistry->magnitude = Body::computeNormalMagnitude(this, normalRegistry->direction);
+	}
 
 	Body::computeTotalNormal(this);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+NormalRegistry* Body::getRestingContact(ListenerObject referent, Vector3D direction)
+{
+	NormalRegistry* normalRegistry = Body::findNormalRegistry(this, referent);
+
+	if(NULL == normalRegistry)
+	{
+		return NULL;
+	}
+
+	// The cached normal is stale if the contact's plane changed
+	if
+	(
+		__BODY_RESTING_CONTACT_DIRECTION_THRESHOLD < __ABS(normalRegistry->direction.x - direction.x)
+		||
+		__BODY_RESTING_CONTACT_DIRECTION_THRESHOLD < __ABS(normalRegistry->direction.y - direction.y)
+		||
+		__BODY_RESTING_CONTACT_DIRECTION_THRESHOLD < __ABS(normalRegistry->direction.z - direction.z)
+	)
+	{
+		return NULL;
+	}
+
+	// Or if the body is moving against or away from the referent
+	if(__BODY_RESTING_CONTACT_VELOCITY_THRESHOLD < __ABS(Vector3D::dotProduct(this->velocity, direction)))
+	{
+		return NULL;
+	}
+
+	if(!normalRegistry->active)
+	{
+		normalRegistry->active = true;
+		Body::computeTotalNormal(this);
+	}
+
+	return normalRegistry;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void Body::clearNormalOnAxis(uint16 axis __attribute__ ((unused)))
 {
 	if(!isDeleted(this->normals))
@@ -1438,16 +1745,24 @@ void Body::clearNormalOnAxis(uint16 axis __attribute__ ((unused)))
 
 			NormalRegistry* normalRegistry = (NormalRegistry*)node->data;
 
-			if
+			if(isDeleted(normalRegistry->referent))
+			{
+				VirtualList::removeNode(this->normals, node);
+				delete normalRegistry;
+				computeTotalNormal = true;
+			}
+			else if
 			(
-				isDeleted(normalRegistry->referent) ||
-				((__X_AXIS & axis) && normalRegistry->direction.x) ||
-				((__Y_AXIS & axis) && normalRegistry->direction.y) ||
-				((__Z_AXIS & axis) && normalRegistry->direction.z)
+				normalRegistry->active &&
+				(
+					((__X_AXIS & axis) && normalRegistry->direction.x) ||
+					((__Y_AXIS & axis) && normalRegistry->direction.y) ||
+					((__Z_AXIS & axis) && normalRegistry->direction.z)
+				)
 			)
 			{
-				VirtualList::removeNode(this->normals, node);
-				delete node->data;
+				// Keep the contact cached in case that the body lands on the same referent again
+				normalRegistry->active = false;
 				computeTotalNormal = true;
 			}
 		}
@@ -1581,12 +1896,17 @@ Vector3D Body::getLastNormalDirection()
 
 	Body::computeTotalNormal(this);
 
-	if(!this->normals->head)
+	for(VirtualNode node = this->normals->tail; NULL != node; node = node->previous)
 	{
-		return Vector3D::zero();
+		NormalRegistry* normalRegistry = (NormalRegistry*)node->data;
+
+		if(normalRegistry->active)
+		{
+			return normalRegistry->direction;
+		}
 	}
 
-	return ((NormalRegistry*)VirtualList::back(this->normals))->direction;
+	return Vector3D::zero();
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
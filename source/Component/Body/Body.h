@@ -33,6 +33,16 @@ class Entity;
 #define __BODY_MIN_MASS						__F_TO_FIXED(0.01f)
 #define __BODY_MAX_MASS						__I_TO_FIXED(1)
 
+/// Maximum deviation of a contact's normal from the cached one for the contact to be reused
+#ifndef __BODY_RESTING_CONTACT_DIRECTION_THRESHOLD
+#define __BODY_RESTING_CONTACT_DIRECTION_THRESHOLD	__F_TO_FIXED(0.0625f)
+#endif
+
+/// Maximum speed along a contact's normal for the body to be considered resting on it
+#ifndef __BODY_RESTING_CONTACT_VELOCITY_THRESHOLD
+#define __BODY_RESTING_CONTACT_VELOCITY_THRESHOLD	__PIXELS_TO_METERS(8)
+#endif
+
 #define __PHYSICS_TIME_ELAPSED_STEP			__FIX7_9_EXT_DIV(__1I_FIX7_9_EXT, __FIX7_9_EXT_DIV(__I_TO_FIX7_9_EXT(__TARGET_FPS), \
 											__I_TO_FIX7_9_EXT(__PHYSICS_TIME_ELAPSED_DIVISOR)))
 
@@ -109,6 +119,12 @@ class Body : Component
 	/// Spatial position
 	Vector3D position;
 
+	/// Spatial position before the last fixed time step
+	Vector3D previousPosition;
+
+	/// Position between the previous and the current ones passed to the owner in fixed time step mode
+	Vector3D interpolatedPosition;
+
 	/// Velocity vector
 	Vector3D velocity;
 
@@ -130,7 +146,7 @@ class Body : Component
 	/// Total normal forces applied to the body
 	Vector3D totalNormal;
 
-	/// List of normal for the forces affecting the body
+	/// Contacts that affect the body, one per referent, with their cached normal and friction
 	VirtualList normals;
 
 	/// Body's movement type on each axis
@@ -148,6 +164,12 @@ class Body : Component
 	/// If true, the movement of the body is independent on each axis
 	bool movesIndependentlyOnEachAxis;
 
+	/// If true, the owner is placed at the interpolated position instead of at the physical one
+	bool interpolated;
+
+	/// If true, the owner was placed at the physical position by the last fixed time step
+	bool stepped;
+
 	/// Number of cycles to skip physical simulations to slow down physics
 	int8 skipCycles;
 
@@ -195,6 +217,10 @@ class Body : Component
 	/// __MAXIMUM_FRICTION_COEFFICIENT)
 	static void setGlobalFrictionCoefficient(fixed_t frictionCoefficient);
 
+	/// Set the time that passes between each physical simulation step.
+	/// @param elapsedTimeStep: Time that passes between each physical simulation step
+	static void setGlobalElapsedTimeStep(fix7_9_ext elapsedTimeStep);
+
 	/// Retrieve the time that passes between each physical simulation step.
 	/// @return The time that passes between each physical simulation step
 	static fixed_t getElapsedTimeStep();
@@ -233,6 +259,16 @@ class Body : Component
 	/// @param elapsedTime: Elapsed time since the last call to this method
 	void update(uint16 cycle, fix7_9_ext elapsedTime);
 
+	/// Advance the physics simulation on the body by a fixed time step and place its owner at the
+	/// resulting physical position for the collisions to be processed against it.
+	/// @param cycle: Cycle number during the current second
+	/// @param elapsedTime: Duration of the time step
+	void step(uint16 cycle, fix7_9_ext elapsedTime);
+
+	/// Move the owner to a position between the ones before and after the last fixed time step.
+	/// @param alpha: Fraction of the time step elapsed since the last fixed time step (between 0 and 1)
+	void interpolate(fixed_t alpha);
+
 	/// Apply a force to the body.
 	/// @param force: Force to be applied
 	uint8 applyForce(const Vector3D* force);
@@ -319,6 +355,10 @@ class Body : Component
 	/// @return Pointer to the body's 3D vector defining its position
 	const Vector3D* getPosition();
 
+	/// Retrieve the position passed to the owner in fixed time step mode.
+	/// @return Pointer to the body's interpolated position
+	const Vector3D* getInterpolatedPosition();
+
 	/// Set the body's maximum velocity.
 	/// @param maximumVelocity: 3D vector defining the body's maximum speed on each axis
 	/// (only applicable when the body's movement is independent on each axis)
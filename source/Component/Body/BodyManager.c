@@ -13,9 +13,11 @@
 
 #include <Body.h>
 #include <DebugConfig.h>
+#include <FrameRate.h>
 #include <Printer.h>
 #include <VirtualList.h>
 #include <VirtualNode.h>
+#include <VUEngine.h>
 
 #include "BodyManager.h"
 
@@ -49,7 +51,11 @@ void BodyManager::constructor()
 	this->frictionCoefficient = 0;
 	this->timeScale = __1I_FIXED;
 	this->cycle = 0;
+	this->accumulatedTimeUS = 0;
+	this->fixedElapsedTime = __PHYSICS_TIME_ELAPSED_STEP;
+	this->fixedStepsPerSecond = 0;
 
+	Body::setGlobalElapsedTimeStep(this->fixedElapsedTime);
 	BodyManager::setTimeScale(this, __1I_FIXED);
 }
 
@@ -99,12 +105,24 @@ Body BodyManager::create(Entity owner, const BodySpec* bodySpec)
 void BodyManager::reset()
 {
 	this->cycle = 0;
+	this->accumulatedTimeUS = 0;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 void BodyManager::update()
 {
+	if(0 != this->fixedStepsPerSecond)
+	{
+		for(uint16 steps = BodyManager::prepareFixedTimeSteps(this); 0 < steps; steps--)
+		{
+			BodyManager::simulateFixedTimeStep(this);
+		}
+
+		BodyManager::interpolate(this);
+		return;
+	}
+
 	if(__TARGET_FPS < ++this->cycle)
 	{
 		this->cycle = 1;
@@ -131,59 +149,93 @@ void BodyManager::update()
 		}
 	}
 
-	for(VirtualNode node = this->components->head, nextNode = NULL; NULL != node; node = nextNode)
+	fix7_9_ext elapsedTime = __PHYSICS_TIME_ELAPSED_STEP;
+
+	uint16 gameFrameRate = VUEngine::getGameFrameRate();
+	uint16 governedGameFrameRate = VUEngine::getGovernedGameFrameRate();
+
+	if(governedGameFrameRate < gameFrameRate)
 	{
-		nextNode = node->next;
+		// The game frames last longer while the frame rate governor has lowered the frame rate
+		elapsedTime = __FIX7_9_EXT_DIV(__FIX7_9_EXT_MULT(elapsedTime, __I_TO_FIX7_9_EXT(gameFrameRate)), __I_TO_FIX7_9_EXT(governedGameFrameRate));
+	}
 
-		Body body = Body::safeCast(node->data);
+	Body::setGlobalElapsedTimeStep(elapsedTime);
 
-		NM_ASSERT(!isDeleted(body), "BodyManager::update: deleted body");
+	BodyManager::simulate(this, elapsedTime, false);
+}
 
-		if(body->deleteMe)
-		{
-			VirtualList::removeNode(this->components, node);
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-			delete body;
-			continue;
-		}
+uint16 BodyManager::prepareFixedTimeSteps()
+{
+	if(0 == this->fixedStepsPerSecond)
+	{
+		return 0;
+	}
 
-		if(!body->awake)
-		{
-			continue;
-		}
+	uint8 targetFPS = FrameRate::getTargetFPS(FrameRate::getInstance());
+	uint32 gameFrameDurationUS = __MICROSECONDS_PER_SECOND / (0 < targetFPS ? targetFPS : __TARGET_FPS);
+	uint32 stepDurationUS = __MICROSECONDS_PER_SECOND / this->fixedStepsPerSecond;
 
-		if(__NO_AXIS != body->axisSubjectToGravity && Entity::isSubjectToGravity(body->owner, this->gravity))
-		{
-			// Check if necessary to apply gravity
-			uint16 movingState = Body::getMovementOnAllAxis(body);
+	// The time scale slows down the simulated time instead of skipping game frames
+	this->accumulatedTimeUS += (gameFrameDurationUS * this->timeScale) / __1I_FIXED;
 
-			uint16 gravitySensibleAxis =
-				body->axisSubjectToGravity
-				&
-				(
-					(__X_AXIS & ~(__X_AXIS & movingState)) 
-					| 
-					(__Y_AXIS & ~(__Y_AXIS & movingState)) 
-					|
-					(__Z_AXIS & ~(__Z_AXIS & movingState))
-				);
+	uint32 steps = this->accumulatedTimeUS / stepDurationUS;
 
-			if(__NO_AXIS != gravitySensibleAxis)
-			{
-				fixed_t mass = Body::getMass(body);
+	if(__BODY_MANAGER_MAXIMUM_FIXED_STEPS_PER_FRAME < steps)
+	{
+		// Drop the time that cannot be simulated to avoid spiraling when the game frame takes too long
+		steps = __BODY_MANAGER_MAXIMUM_FIXED_STEPS_PER_FRAME;
+		this->accumulatedTimeUS %= stepDurationUS;
+	}
+	else
+	{
+		this->accumulatedTimeUS -= steps * stepDurationUS;
+	}
 
-				Vector3D force =
-				{
-					__X_AXIS & gravitySensibleAxis ? __FIXED_MULT(this->gravity.x, mass) : 0,
-					__Y_AXIS & gravitySensibleAxis ? __FIXED_MULT(this->gravity.y, mass) : 0,
-					__Z_AXIS & gravitySensibleAxis ? __FIXED_MULT(this->gravity.z, mass) : 0,
-				};
+	return (uint16)steps;
+}
 
-				Body::applyForce(body, &force);
-			}
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void BodyManager::simulateFixedTimeStep()
+{
+	if(this->fixedStepsPerSecond < ++this->cycle)
+	{
+		this->cycle = 1;
+	}
+
+	BodyManager::simulate(this, this->fixedElapsedTime, true);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void BodyManager::interpolate()
+{
+	if(0 == this->fixedStepsPerSecond)
+	{
+		return;
+	}
+
+	uint32 stepDurationUS = __MICROSECONDS_PER_SECOND / this->fixedStepsPerSecond;
+	fixed_t alpha = (fixed_t)((this->accumulatedTimeUS * __1I_FIXED) / stepDurationUS);
+
+	for(VirtualNode node = this->components->head; NULL != node; node = node->next)
+	{
+		Body body = Body::safeCast(node->data);
+
+		if(body->deleteMe)
+		{
+			continue;
+		}
+
+		if(!body->awake)
+		{
+			body->previousPosition = body->position;
 		}
 
-		Body::update(body, this->cycle, __PHYSICS_TIME_ELAPSED_STEP);
+		Body::interpolate(body, alpha);
 	}
 }
 
@@ -231,11 +283,54 @@ uint32 BodyManager::getTimeScale()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+void BodyManager::setFixedTimeStep(uint16 fixedStepsPerSecond)
+{
+	this->fixedStepsPerSecond = fixedStepsPerSecond;
+	this->accumulatedTimeUS = 0;
+	this->cycle = 0;
+
+	if(0 == this->fixedStepsPerSecond)
+	{
+		this->fixedElapsedTime = __PHYSICS_TIME_ELAPSED_STEP;
+	}
+	else
+	{
+		this->fixedElapsedTime = __FIX7_9_EXT_DIV(__1I_FIX7_9_EXT, __I_TO_FIX7_9_EXT(this->fixedStepsPerSecond));
+	}
+
+	Body::setGlobalElapsedTimeStep(this->fixedElapsedTime);
+
+	for(VirtualNode node = this->components->head; NULL != node; node = node->next)
+	{
+		Body body = Body::safeCast(node->data);
+
+		body->previousPosition = body->position;
+		body->interpolatedPosition = body->position;
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+uint16 BodyManager::getFixedTimeStep()
+{
+	return this->fixedStepsPerSecond;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void BodyManager::setGravity(Vector3D gravity)
 {
 	this->gravity = gravity;
 
 	Body::setGlobalGravity(this->gravity);
+
+	// Refresh each body's gravity and the weight on the normals that it rests on
+	for(VirtualNode node = this->components->head; NULL != node; node = node->next)
+	{
+		Body body = Body::safeCast(node->data);
+
+		Body::setAxisSubjectToGravity(body, Body::getAxisSubjectToGravity(body));
+	}
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -288,3 +383,76 @@ void BodyManager::print(int32 x, int32 y)
 #endif
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void BodyManager::simulate(fix7_9_ext elapsedTime, bool fixedTimeStep)
+{
+	for(VirtualNode node = this->components->head, nextNode = NULL; NULL != node; node = nextNode)
+	{
+		nextNode = node->next;
+
+		Body body = Body::safeCast(node->data);
+
+		NM_ASSERT(!isDeleted(body), "BodyManager::simulate: deleted body");
+
+		if(body->deleteMe)
+		{
+			VirtualList::removeNode(this->components, node);
+
+			delete body;
+			continue;
+		}
+
+		if(!body->awake)
+		{
+			continue;
+		}
+
+		if(__NO_AXIS != body->axisSubjectToGravity && Entity::isSubjectToGravity(body->owner, this->gravity))
+		{
+			// Check if necessary to apply gravity
+			uint16 movingState = Body::getMovementOnAllAxis(body);
+
+			uint16 gravitySensibleAxis =
+				body->axisSubjectToGravity
+				&
+				(
+					(__X_AXIS & ~(__X_AXIS & movingState)) 
+					| 
+					(__Y_AXIS & ~(__Y_AXIS & movingState)) 
+					|
+					(__Z_AXIS & ~(__Z_AXIS & movingState))
+				);
+
+			if(__NO_AXIS != gravitySensibleAxis)
+			{
+				fixed_t mass = Body::getMass(body);
+
+				Vector3D force =
+				{
+					__X_AXIS & gravitySensibleAxis ? __FIXED_MULT(this->gravity.x, mass) : 0,
+					__Y_AXIS & gravitySensibleAxis ? __FIXED_MULT(this->gravity.y, mass) : 0,
+					__Z_AXIS & gravitySensibleAxis ? __FIXED_MULT(this->gravity.z, mass) : 0,
+				};
+
+				Body::applyForce(body, &force);
+			}
+		}
+
+		if(fixedTimeStep)
+		{
+			Body::step(body, this->cycle, elapsedTime);
+		}
+		else
+		{
+			Body::update(body, this->cycle, elapsedTime);
+		}
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -19,6 +19,15 @@
 #include <Entity.h>
 #include <Clock.h>
 
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Maximum number of fixed time steps to simulate per game frame before dropping the pending time
+#ifndef __BODY_MANAGER_MAXIMUM_FIXED_STEPS_PER_FRAME
+#define __BODY_MANAGER_MAXIMUM_FIXED_STEPS_PER_FRAME		4
+#endif
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DECLARATION
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -41,8 +50,17 @@ class BodyManager : ComponentManager
 	/// Time scale for time step on each call to update
 	fixed_t timeScale;
 
+	/// Microseconds pending to be simulated in fixed time step mode
+	uint32 accumulatedTimeUS;
+
+	/// Duration of each fixed time step
+	fix7_9_ext fixedElapsedTime;
+
+	/// Fixed time steps per second (0 if the physics are advanced once per game frame)
+	uint16 fixedStepsPerSecond;
+
 	/// Cycle of physical simulation during the current second
-	uint8 cycle;
+	uint16 cycle;
 
 	/// Number of cycles to skip physical simulations to slow down physics
 	uint8 skipCycles;
@@ -77,6 +95,16 @@ class BodyManager : ComponentManager
 	/// Update the registered bodies by advancing the physics simulations.
 	void update();
 
+	/// Add the duration of a game frame to the time pending to be simulated in fixed time step mode.
+	/// @return Number of fixed time steps to simulate during the current game frame
+	uint16 prepareFixedTimeSteps();
+
+	/// Advance the registered bodies by a fixed time step and place their owners at their physical positions.
+	void simulateFixedTimeStep();
+
+	/// Move the bodies' owners to positions interpolated between the last two fixed time steps.
+	void interpolate();
+
 	/// Set the time scale for time step on each call to update.
 	/// @param timeScale: Time scale for time step on each call to update
 	void setTimeScale(fixed_t timeScale);
@@ -85,6 +113,17 @@ class BodyManager : ComponentManager
 	/// @return Time scale for time step on each call to update
 	uint32 getTimeScale();
 
+	/// Make the physics run on their own fixed tick, decoupled from the game frame rate. The bodies' owners 
+	/// are moved to positions interpolated between the last two fixed time steps; moving an owner displaces
+	/// its body's physical state by the same amount. The game state processes the collisions after each 
+	/// fixed time step, against the physical positions.
+	/// @param fixedStepsPerSecond: Fixed time steps per second (0 to advance the physics once per game frame)
+	void setFixedTimeStep(uint16 fixedStepsPerSecond);
+
+	/// Retrieve the number of fixed time steps per second.
+	/// @return Fixed time steps per second (0 if the physics are advanced once per game frame)
+	uint16 getFixedTimeStep();
+
 	/// Set the physical world's gravity.
 	/// @param gravity: Gravity to set in the current physical world
 	void setGravity(Vector3D gravity);
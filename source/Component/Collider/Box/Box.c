@@ -70,6 +70,7 @@ void Box::constructor(Entity owner, const ColliderSpec* colliderSpec)
 	this->classIndex = kColliderBoxIndex;
 	this->rotationVertexDisplacement = Vector3D::zero();
 	this->normals = NULL;
+	this->vertexes = NULL;
 
 	for(int32 normalIndex = 0; normalIndex < __COLLIDER_NORMALS; normalIndex++)
 	{
@@ -79,6 +80,9 @@ void Box::constructor(Entity owner, const ColliderSpec* colliderSpec)
 
 	Box::computeRightBox(this);
 	Box::projectOntoItself(this);
+
+	// Force the geometry to be computed again once the collider's position has been updated
+	this->geometryGeneration = this->displacementGeneration - 1;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -98,6 +102,12 @@ void Box::destructor()
 		this->normals = NULL;
 	}
 
+	if(NULL != this->vertexes)
+	{
+		delete this->vertexes;
+		this->vertexes = NULL;
+	}
+
 	// Always explicitly call the base's destructor 
 	Base::destructor();
 }
@@ -293,7 +303,12 @@ void Box::getVertexes(Vector3D vertexes[__BOX_VERTEXES])
 
 void Box::projectOntoItself()
 {
-	Vector3D vertexes[__BOX_VERTEXES];
+	if(NULL == this->vertexes)
+	{
+		this->vertexes = new BoxVertexes;
+	}
+
+	Vector3D* vertexes = this->vertexes->vectors;
 	Box::getVertexes(this, vertexes);
 
 	// Compute normals
@@ -311,6 +326,20 @@ void Box::projectOntoItself()
 			&this->vertexProjections[normalIndex].max
 		);
 	}
+
+	this->geometryGeneration = this->displacementGeneration;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Box::updateGeometry()
+{
+	if(NULL != this->vertexes && this->geometryGeneration == this->displacementGeneration)
+	{
+		return;
+	}
+
+	Box::projectOntoItself(this);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -23,6 +23,17 @@
 
 #define __BOX_VERTEXES	8
 
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DATA
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Vertexes of a box in world space
+/// @memberof Box
+typedef struct BoxVertexes
+{
+	Vector3D vectors[__BOX_VERTEXES];
+} BoxVertexes;
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DECLARATION
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -49,6 +60,12 @@ class Box : Collider
 	/// The normals of the box
 	Normals* normals;
 
+	/// Vertexes of the box in world space, cached for the collision tests during the same game frame
+	BoxVertexes* vertexes;
+
+	/// Displacement generation for which the vertexes, normals and projections were computed
+	uint8 geometryGeneration;
+
 	// For rotation purposes
 	Vector3D rotationVertexDisplacement;
 
@@ -82,6 +99,10 @@ class Box : Collider
 
 	/// Project the box's vertexes onto its normals.
 	void projectOntoItself();
+
+	/// Compute the box's vertexes, normals and projections if the collider's position
+	/// has changed since the last time that they were computed.
+	void updateGeometry();
 }
 
 #endif
@@ -70,6 +70,7 @@ void Collider::constructor(Entity owner, const ColliderSpec* colliderSpec)
 */
 	this->position = Vector3D::sum(this->transformation->position, Vector3D::getFromPixelVector(colliderSpec->displacement));
 	this->positionGeneration = 0;
+	this->displacementGeneration = 0;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -731,6 +732,10 @@ void Collider::displaceOwner(Vector3D displacement)
 	ownerPosition.z += displacement.z;
 
 	Entity::setPosition(this->owner, &ownerPosition);
+
+	// Keep the cached position in sync so the geometry derived from it is computed again
+	this->position = Vector3D::sum(this->position, displacement);
+	this->displacementGeneration++;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -193,6 +193,10 @@ abstract class Collider : Component
 	/// Counter to force the computation of the collider's position
 	uint8 positionGeneration;
 
+	/// Counter bumped every time that the position changes, either because it was computed again
+	/// or because the owner was displaced to solve a collision
+	uint8 displacementGeneration;
+
 	/// Class index to avoid using __GET_CAST when checking for collisions
 	uint8 classIndex;
 
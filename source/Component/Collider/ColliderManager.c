@@ -15,6 +15,7 @@
 #include <DebugConfig.h>
 #include <Printer.h>
 #include <Entity.h>
+#include <FrameArena.h>
 #include <Collider.h>
 #include <VirtualList.h>
 
@@ -106,6 +107,8 @@ uint32 ColliderManager::update()
 
 	this->positionGeneration++;
 
+	uint16 activeColliders = 0;
+
 	for(VirtualNode auxNode = this->components->head, auxNextNode = NULL; NULL != auxNode; auxNode = auxNextNode)
 	{
 		auxNextNode = auxNode->next;
@@ -135,81 +138,66 @@ uint32 ColliderManager::update()
 		}
 #endif
 
-		if(!(collider->enabled && collider->checkForCollisions) || __NON_TRANSFORMED == collider->transformation->invalid)
+		if(collider->enabled && __NON_TRANSFORMED != collider->transformation->invalid)
 		{
-			continue;
+			activeColliders++;
 		}
+	}
 
-		if(collider->positionGeneration != this->positionGeneration)
-		{
-			Vector3D displacement = 
-			Vector3D::rotate
-			(
-				Vector3D::getFromPixelVector(((ColliderSpec*)collider->componentSpec)->displacement), collider->transformation->rotation
-			);
+	// Gather the colliders that can collide in a transient array to not walk the list for each pair
+	Collider* colliders = 0 < activeColliders ? (Collider*)FrameArena::allocate(activeColliders * sizeof(Collider)) : NULL;
 
-			collider->position = Vector3D::sum(collider->transformation->position, displacement);
-			collider->positionGeneration = this->positionGeneration;
-		}
+	if(NULL != colliders)
+	{
+		uint16 i = 0;
 
-		for(VirtualNode node = this->components->head; NULL != node; node = node->next)
+		for(VirtualNode node = this->components->head; NULL != node && i < activeColliders; node = node->next)
 		{
-			Collider colliderToCheck = Collider::safeCast(node->data);
+			Collider collider = Collider::safeCast(node->data);
 
-			if(colliderToCheck->deleteMe || !colliderToCheck->enabled || __NON_TRANSFORMED == colliderToCheck->transformation->invalid)
+			if(collider->enabled && __NON_TRANSFORMED != collider->transformation->invalid)
 			{
-				continue;
+				colliders[i++] = collider;
 			}
+		}
 
-#ifdef __DEBUGGING_COLLISIONS
-			_lastCycleCheckProducts++;
-#endif
+		for(i = 0; i < activeColliders; i++)
+		{
+			// Collision callbacks run arbitrary code, make sure none of it released the frame's arena
+			ASSERT(FrameArena::isValid(colliders), "ColliderManager::update: stale frame arena block");
 
-			if
-			(
-				0 != (collider->layersToIgnore & colliderToCheck->layers)
-				||
-				(collider->owner == colliderToCheck->owner)
-				||
-				__NON_TRANSFORMED == colliderToCheck->transformation->invalid
-			)
+			Collider collider = colliders[i];
+
+			if(collider->deleteMe || !(collider->enabled && collider->checkForCollisions) || __NON_TRANSFORMED == collider->transformation->invalid)
 			{
 				continue;
 			}
 
-#ifdef __DEBUGGING_COLLISIONS
-			_lastCycleCollisionChecks++;
-#endif
+			ColliderManager::updateColliderPosition(this, collider);
 
-			if(colliderToCheck->positionGeneration != this->positionGeneration)
+			for(uint16 j = 0; j < activeColliders; j++)
 			{
-				Vector3D displacement = 
-					Vector3D::rotate
-					(
-						Vector3D::getFromPixelVector(((ColliderSpec*)colliderToCheck->componentSpec)->displacement), 
-						colliderToCheck->transformation->rotation
-					);	
-				
-				colliderToCheck->position = Vector3D::sum(colliderToCheck->transformation->position, displacement);
-				colliderToCheck->positionGeneration = this->positionGeneration;
+				ColliderManager::testCollision(this, collider, colliders[j]);
 			}
+		}
+	}
+	else
+	{
+		for(VirtualNode auxNode = this->components->head; NULL != auxNode; auxNode = auxNode->next)
+		{
+			Collider collider = Collider::safeCast(auxNode->data);
 
-			fixed_ext_t distanceVectorSquareLength = 
-				Vector3D::squareLength(Vector3D::get(colliderToCheck->position, collider->position));
-
-			if(__FIXED_SQUARE(__COLLIDER_MAXIMUM_SIZE) < distanceVectorSquareLength)
+			if(collider->deleteMe || !(collider->enabled && collider->checkForCollisions) || __NON_TRANSFORMED == collider->transformation->invalid)
 			{
 				continue;
 			}
 
-#ifdef __DEBUGGING_COLLISIONS
-			if(kNoCollision != Collider::collides(collider, colliderToCheck))
+			ColliderManager::updateColliderPosition(this, collider);
+
+			for(VirtualNode node = this->components->head; NULL != node; node = node->next)
 			{
-				_lastCycleCollisions++;
+				ColliderManager::testCollision(this, collider, Collider::safeCast(node->data));
 			}
-#else
-			Collider::collides(collider, colliderToCheck);
-#endif
 		}
 	}
 
@@ -326,6 +314,66 @@ void ColliderManager::destructor()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+void ColliderManager::updateColliderPosition(Collider collider)
+{
+	if(collider->positionGeneration != this->positionGeneration)
+	{
+		Vector3D displacement = 
+			Vector3D::rotate
+			(
+				Vector3D::getFromPixelVector(((ColliderSpec*)collider->componentSpec)->displacement), collider->transformation->rotation
+			);
+
+		collider->position = Vector3D::sum(collider->transformation->position, displacement);
+		collider->positionGeneration = this->positionGeneration;
+		collider->displacementGeneration++;
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void ColliderManager::testCollision(Collider collider, Collider colliderToCheck)
+{
+	if(colliderToCheck->deleteMe || !colliderToCheck->enabled || __NON_TRANSFORMED == colliderToCheck->transformation->invalid)
+	{
+		return;
+	}
+
+#ifdef __DEBUGGING_COLLISIONS
+	_lastCycleCheckProducts++;
+#endif
+
+	if(0 != (collider->layersToIgnore & colliderToCheck->layers) || collider->owner == colliderToCheck->owner)
+	{
+		return;
+	}
+
+#ifdef __DEBUGGING_COLLISIONS
+	_lastCycleCollisionChecks++;
+#endif
+
+	ColliderManager::updateColliderPosition(this, colliderToCheck);
+
+	fixed_ext_t distanceVectorSquareLength = 
+		Vector3D::squareLength(Vector3D::get(colliderToCheck->position, collider->position));
+
+	if(__FIXED_SQUARE(__COLLIDER_MAXIMUM_SIZE) < distanceVectorSquareLength)
+	{
+		return;
+	}
+
+#ifdef __DEBUGGING_COLLISIONS
+	if(kNoCollision != Collider::collides(collider, colliderToCheck))
+	{
+		_lastCycleCollisions++;
+	}
+#else
+	Collider::collides(collider, colliderToCheck);
+#endif
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 int32 ColliderManager::getNumberOfEnabledColliders()
 {
 	int32 count = 0;
@@ -113,22 +113,12 @@ static void CollisionTester::testOverlaping(Collider requesterCollider, Collider
 
 static void CollisionTester::getSolutionVectorBetweenBoxAndBox(Box boxA, Box boxB, SolutionVector* solutionVector)
 {
-	// Get the vertexes of each box
-	Vector3D boxAVertexes[__BOX_VERTEXES];
-	Vector3D boxBVertexes[__BOX_VERTEXES];
-	Box::getVertexes(boxA, boxAVertexes);
-	Box::getVertexes(boxB, boxBVertexes);
-
-	// If the normals have not been computed yet do so now
-	if(!boxA->normals)
-	{
-		Box::projectOntoItself(boxA);
-	}
+	// Reuse the vertexes, normals and projections already computed during this game frame
+	Box::updateGeometry(boxA);
+	Box::updateGeometry(boxB);
 
-	if(!boxB->normals)
-	{
-		Box::projectOntoItself(boxB);
-	}
+	Vector3D* boxAVertexes = boxA->vertexes->vectors;
+	Vector3D* boxBVertexes = boxB->vertexes->vectors;
 
 	Vector3D* normals[2] =
 	{
@@ -358,11 +348,8 @@ static void CollisionTester::getSolutionVectorBetweenBallAndLineField(Ball ball,
 
 static void CollisionTester::getSolutionVectorBetweenBoxAndBall(Box boxA, Ball ballB, SolutionVector* solutionVector)
 {
-	// If the normals have not been computed yet do so now
-	if(NULL == boxA->normals)
-	{
-		Box::projectOntoItself(boxA);
-	}
+	// Reuse the vertexes, normals and projections already computed during this game frame
+	Box::updateGeometry(boxA);
 
 	Vector3D* normals = boxA->normals->vectors;
 
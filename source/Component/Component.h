@@ -24,6 +24,16 @@
 
 class Entity;
 
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Padding in pixels added to the owner's radius to decide if it is in camera range
+/// when a component's update policy is kComponentUpdateInCameraRange
+#ifndef __COMPONENT_UPDATE_CAMERA_RANGE_PADDING
+#define __COMPONENT_UPDATE_CAMERA_RANGE_PADDING		64
+#endif
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DATA
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -54,6 +64,35 @@ enum ComponentTypes
 	kComponentTypes,
 };
 
+/// Component update policies
+/// @memberof Component
+enum ComponentUpdatePolicies
+{
+	// Update on every game frame
+	kComponentUpdateEveryFrame = 0,
+
+	// Update once every updateInterval game frames
+	kComponentUpdateEveryNthFrame,
+
+	// Update only while the owner is within the camera's range
+	kComponentUpdateInCameraRange,
+};
+
+/// Update schedule of components that are updated according to a policy
+/// @memberof Component
+typedef struct ComponentUpdateSchedule
+{
+	/// How often the component is updated (ComponentUpdatePolicies)
+	uint8 policy;
+
+	/// Game frames between updates when the policy is kComponentUpdateEveryNthFrame
+	uint8 interval;
+
+	/// Game frames left until the next update when the policy is kComponentUpdateEveryNthFrame
+	uint8 framesUntilUpdate;
+
+} ComponentUpdateSchedule;
+
 /// A Component Spec
 /// @memberof Component
 typedef struct ComponentSpec
@@ -14,6 +14,7 @@
 #include <Component.h>
 #include <Printer.h>
 #include <Entity.h>
+#include <Vector3D.h>
 #include <VirtualList.h>
 
 #include "ComponentManager.h"
@@ -644,6 +645,9 @@ void ComponentManager::constructor()
 	Base::constructor();
 
 	this->components = new VirtualList();
+	this->nextUpdatePhase = 0;
+	this->updatedComponents = 0;
+	this->enabledComponents = 0;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -733,6 +737,83 @@ void ComponentManager::purgeComponents()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+void ComponentManager::scheduleUpdates(ComponentUpdateSchedule* updateSchedule)
+{
+	if(NULL == updateSchedule || kComponentUpdateEveryNthFrame != updateSchedule->policy)
+	{
+		return;
+	}
+
+	updateSchedule->framesUntilUpdate = this->nextUpdatePhase++ % updateSchedule->interval;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+bool ComponentManager::isDue(ComponentUpdateSchedule* updateSchedule, Component component)
+{
+	if(NULL == updateSchedule)
+	{
+		return true;
+	}
+
+	switch(updateSchedule->policy)
+	{
+		case kComponentUpdateEveryNthFrame:
+		{
+			if(0 < updateSchedule->framesUntilUpdate)
+			{
+				updateSchedule->framesUntilUpdate--;
+				return false;
+			}
+
+			updateSchedule->framesUntilUpdate = updateSchedule->interval - 1;
+			return true;
+		}
+
+		case kComponentUpdateInCameraRange:
+		{
+			if(NULL == component->transformation || isDeleted(component->owner))
+			{
+				return true;
+			}
+
+			// Big owners are in range as soon as any part of them may be
+			fixed_t padding = 
+				__PIXELS_TO_METERS(__COMPONENT_UPDATE_CAMERA_RANGE_PADDING) + Entity::getRadius(component->owner);
+
+			return Vector3D::isInsideFrustrum
+			(
+				component->transformation->position, (RightBox){-padding, -padding, -padding, padding, padding, padding}
+			);
+		}
+	}
+
+	return true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+uint16 ComponentManager::getUpdatedComponents()
+{
+	return this->updatedComponents;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void ComponentManager::print(int32 x, int32 y)
+{
+	Printer::text(__GET_CLASS_NAME(this), x, y++, NULL);
+	y++;
+	Printer::text("REGISTERED:     ", x, ++y, NULL);
+	Printer::int32(VirtualList::getCount(this->components), x + 12, y, NULL);
+	Printer::text("ENABLED:        ", x, ++y, NULL);
+	Printer::int32(this->enabledComponents, x + 12, y, NULL);
+	Printer::text("UPDATED:        ", x, ++y, NULL);
+	Printer::int32(this->updatedComponents, x + 12, y, NULL);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' PRIVATE METHODS
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -42,6 +42,15 @@ abstract class ComponentManager : ListenerObject
 	/// List of components
 	VirtualList components;
 
+	/// Rolling counter used to spread the components updated every Nth frame across game frames
+	uint16 nextUpdatePhase;
+
+	/// Number of components updated during the last game frame
+	uint16 updatedComponents;
+
+	/// Number of enabled components during the last game frame
+	uint16 enabledComponents;
+
 	/// @publicsection
 
 	/// Create a component with the specified owner.
@@ -151,6 +160,27 @@ abstract class ComponentManager : ListenerObject
 
 	/// Force the purging of deleted components.
 	virtual void purgeComponents();
+
+	/// Set up the update schedule of a newly created component; the ones updated every Nth frame
+	/// are spread across game frames so that those that share the same interval are not all
+	/// updated on the same game frame.
+	/// @param updateSchedule: Update schedule of the component
+	void scheduleUpdates(ComponentUpdateSchedule* updateSchedule);
+
+	/// Check if a component is due to be updated during the current game frame.
+	/// @param updateSchedule: Update schedule of the component
+	/// @param component: Component to check
+	/// @return True if the component has to be updated; false otherwise
+	bool isDue(ComponentUpdateSchedule* updateSchedule, Component component);
+
+	/// Retrieve the number of components updated during the last game frame.
+	/// @return Number of components updated during the last game frame
+	uint16 getUpdatedComponents();
+
+	/// Print the manager's statistics.
+	/// @param x: Screen x coordinate where to print
+	/// @param y: Screen y coordinate where to print
+	void print(int32 x, int32 y);
 }
 
 #endif
@@ -25,6 +25,9 @@ void Mutator::constructor(Entity owner, const MutatorSpec* mutatorSpec)
 	Base::constructor(owner, (const ComponentSpec*)&mutatorSpec->componentSpec);
 
 	this->enabled = mutatorSpec->enabled;
+	this->updateSchedule.policy = mutatorSpec->updatePolicy;
+	this->updateSchedule.interval = 1 < mutatorSpec->updateInterval ? mutatorSpec->updateInterval : 1;
+	this->updateSchedule.framesUntilUpdate = 0;
 
 	if(NULL != mutatorSpec->targetClass)
 	{
@@ -62,3 +65,15 @@ bool Mutator::isEnabled()
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+uint8 Mutator::getUpdatePolicy()
+{
+	return this->updateSchedule.policy;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Mutator::update()
+{}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -33,6 +33,12 @@ typedef struct MutatorSpec
 	/// Enabled?
 	bool enabled;
 
+	/// How often the mutator is updated (ComponentUpdatePolicies)
+	uint8 updatePolicy;
+
+	/// Game frames between updates when the policy is kComponentUpdateEveryNthFrame
+	uint8 updateInterval;
+
 } MutatorSpec;
 
 /// A Mutator spec that is stored in ROM
@@ -56,6 +62,9 @@ class Mutator : Component
 	/// Flag to allow or prohibit the mutator to perform its operations
 	bool enabled;
 
+	/// Schedule that determines when the mutator is updated
+	ComponentUpdateSchedule updateSchedule;
+
 	/// @publicsection
 
 	/// Class' constructor
@@ -72,6 +81,13 @@ class Mutator : Component
 	/// Check if the mutator's operations are enabled.
 	/// @return True if the mutator's operations are enabled; false otherwise
 	bool isEnabled();
+
+	/// Retrieve the mutator's update policy.
+	/// @return Update policy (ComponentUpdatePolicies)
+	uint8 getUpdatePolicy();
+
+	/// Perform the mutator's operations. Called by the manager according to the update policy.
+	virtual void update();
 }
 
 #endif
@@ -58,13 +58,23 @@ Mutator MutatorManager::create(Entity owner, const MutatorSpec* mutatorSpec)
 		return NULL;
 	}
 
-	return ((Mutator (*)(Entity, const MutatorSpec*)) ((ComponentSpec*)mutatorSpec)->allocator)(owner, mutatorSpec);
+	Mutator mutator = ((Mutator (*)(Entity, const MutatorSpec*)) ((ComponentSpec*)mutatorSpec)->allocator)(owner, mutatorSpec);
+
+	if(!isDeleted(mutator))
+	{
+		ComponentManager::scheduleUpdates(this, &mutator->updateSchedule);
+	}
+
+	return mutator;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 void MutatorManager::update()
 {
+	this->updatedComponents = 0;
+	this->enabledComponents = 0;
+
 	for(VirtualNode node = this->components->head, nextNode = NULL; NULL != node; node = nextNode)
 	{
 		nextNode = node->next;
@@ -80,6 +90,22 @@ void MutatorManager::update()
 			delete mutator;
 			continue;
 		}
+
+		if(!mutator->enabled)
+		{
+			continue;
+		}
+
+		this->enabledComponents++;
+
+		if(!ComponentManager::isDue(this, &mutator->updateSchedule, Component::safeCast(mutator)))
+		{
+			continue;
+		}
+
+		Mutator::update(mutator);
+
+		this->updatedComponents++;
 	}
 }
 
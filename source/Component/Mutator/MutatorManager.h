@@ -29,8 +29,6 @@
 /// Manages all the mutator instances.
 class MutatorManager : ComponentManager
 {
-	/// @protectedsection
-
 	/// @publicsection
 
 	/// Class' constructor
@@ -56,7 +54,7 @@ class MutatorManager : ComponentManager
 	/// Reset the manager's state
 	void reset();
 
-	/// Update the registered bodies by advancing the physics simulations.
+	/// Update the registered mutators according to their update policies.
 	void update();
 }
 
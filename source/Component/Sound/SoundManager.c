@@ -11,10 +11,13 @@
 // INCLUDES
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+#include <Profiler.h>
 #include <Sound.h>
 #include <Timer.h>
 #include <VirtualList.h>
+#include <VUEngine.h>
 #include <SoundUnit.h>
+#include <SoundVoiceAllocator.h>
 #include <WaveForms.h>
 
 #include "SoundManager.h"
@@ -40,6 +43,8 @@ void SoundManager::constructor()
 	Base::constructor();
 
 	this->lock = false;
+
+	SoundVoiceAllocator::reset();
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -60,7 +65,17 @@ bool SoundManager::onEvent(ListenerObject eventFirer, uint16 eventCode)
 	{
 		case kEventTimerInterrupt:
 		{
-			if(SoundManager::playSounds(this))
+#ifdef __ENABLE_PROFILER
+			Profiler::lap(kProfilerLapTypeStartInterrupt, NULL);
+#endif
+
+			bool playing = SoundManager::playSounds(this);
+
+#ifdef __ENABLE_PROFILER
+			Profiler::lap(kProfilerLapTypeTimerInterruptProcess, PROCESS_NAME_SOUND_PLAY);
+#endif
+
+			if(playing)
 			{
 				return true;
 			}
@@ -164,6 +179,7 @@ void SoundManager::update()
 bool SoundManager::playSounds()
 {
 	SoundUnit::update(SoundUnit::getInstance());
+	SoundVoiceAllocator::update();
 
 	for(VirtualNode node = this->components->head; NULL != node; node = node->next)
 	{
@@ -12,10 +12,17 @@
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 #include <SoundUnit.h>
+#include <SoundVoiceAllocator.h>
 
 #include "SoundTrack.h"
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' ATTRIBUTES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static SoundTrackSeekIndex _seekIndexes[__SOUND_TRACK_SEEK_INDEXES];
+static SoundTrackCheckpoint _checkpoints[__SOUND_TRACK_SEEK_INDEX_CHECKPOINTS];
+static uint16 _usedCheckpoints = 0;
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' PUBLIC METHODS
@@ -27,6 +34,11 @@ void SoundTrack::start(bool wasPaused)
 {
 	if(!wasPaused)
 	{
+		if(NULL == this->seekIndex)
+		{
+			SoundTrack::acquireSeekIndex(this);
+		}
+
 		SoundTrack::reset(this);
 	}
 }
@@ -36,6 +48,7 @@ void SoundTrack::start(bool wasPaused)
 void SoundTrack::stop()
 {
 	SoundUnit::stopSoundSourcesUsedBy(this->id);
+	SoundVoiceAllocator::release(this->id);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -43,6 +56,7 @@ void SoundTrack::stop()
 void SoundTrack::pause()
 {
 	SoundUnit::stopSoundSourcesUsedBy(this->id);
+	SoundVoiceAllocator::release(this->id);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -71,11 +85,23 @@ void SoundTrack::rewind()
 
 fix7_9_ext SoundTrack::loop()
 {
+	if(NULL != this->seekIndex && this->soundTrackSpec->loopPointCursor == this->seekIndex->loopCheckpoint.cursor)
+	{
+		return SoundTrack::restoreCheckpoint(this, &this->seekIndex->loopCheckpoint);
+	}
+
 	return SoundTrack::fastForward(this, this->soundTrackSpec->loopPointCursor);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+fix7_9_ext SoundTrack::seek(uint32 cursor)
+{
+	return SoundTrack::fastForward(this, cursor);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 bool SoundTrack::update
 (
 	fix7_9_ext tickStep, fix7_9_ext targetTimerResolutionFactor, uint8 maximumVolume, uint8 leftVolumeReduction, 
@@ -96,25 +122,69 @@ bool SoundTrack::update
 		return this->finished;
 	}
 
-	this->elapsedTicks -= this->nextElapsedTicksTarget;
-
 	if(this->cursor >= this->samples)
 	{
 		this->finished = true;
+
+		// The voices are not needed anymore, let other tracks have them
+		SoundVoiceAllocator::release(this->id);
+
+		return this->finished;
+	}
+
+	// Let the voice allocator know how loud the track is heard through the loudest speaker
+	int16 audibility = 
+		maximumVolume - (leftVolumeReduction < rightVolumeReduction ? leftVolumeReduction : rightVolumeReduction) - volumeReduction;
+
+	if(0 > audibility)
+	{
+		audibility = 0;
+	}
+
+	SoundVoiceAllocator::setAudibility(this->id, (uint8)audibility);
+
+	// Claim a channel for each of the track's own channels; the allocator hands back the one already 
+	// owned, if any, so the track only competes again when it has none or when it lost it
+	int8 channels[__SOUND_TRACK_MAXIMUM_CHANNELS];
+	bool granted = false;
+	uint8 trackChannels = SoundTrack::getTrackChannels(this);
+
+	for(uint8 trackChannel = 0; trackChannel < __SOUND_TRACK_MAXIMUM_CHANNELS; trackChannel++)
+	{
+		channels[trackChannel] = __SOUND_VOICE_ALLOCATOR_NO_CHANNEL;
+
+		if(trackChannel < trackChannels)
+		{
+			channels[trackChannel] = 
+				SoundTrack::requestVoice(this, trackChannel, SoundTrack::getChannelMask(this, trackChannel), (uint8)audibility);
+
+			granted = granted || __SOUND_VOICE_ALLOCATOR_NO_CHANNEL != channels[trackChannel];
+		}
+	}
+
+	// Wait for a voice to become available unless the track prefers to skip the keyframe
+	if(!granted && !this->soundTrackSpec->skip)
+	{
 		return this->finished;
 	}
 
+	this->elapsedTicks -= this->nextElapsedTicksTarget;
+
 	SoundTrackKeyframe soundTrackKeyframe = this->soundTrackSpec->trackKeyframes[this->cursor];
 
 	this->nextElapsedTicksTarget = __I_TO_FIX7_9_EXT(soundTrackKeyframe.tick);
 
 	SoundTrack::updateCursors(this);
 
-	SoundTrack::sendSoundRequest
-	(
-		this, targetTimerResolutionFactor, maximumVolume, leftVolumeReduction, 
-		rightVolumeReduction, volumeReduction, frequencyDelta
-	);
+	// Denied requests are dropped; the track's channels without a voice are not played
+	if(granted)
+	{
+		SoundTrack::sendSoundRequest
+		(
+			this, channels, targetTimerResolutionFactor, maximumVolume, leftVolumeReduction, 
+			rightVolumeReduction, volumeReduction, frequencyDelta
+		);
+	}
 
 	this->cursor++;
 
@@ -123,6 +193,27 @@ bool SoundTrack::update
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+int8 SoundTrack::requestVoice(uint8 trackChannel, uint8 channelMask, uint8 audibility)
+{
+	SoundVoiceRequest soundVoiceRequest = 
+	{
+		this->id,
+		trackChannel,
+		channelMask,
+		this->soundTrackSpec->priority,
+		audibility
+	};
+
+	uint32 evictedRequesterId = this->id;
+
+	// The evicted track is not silenced as a whole: the request sent through the granted channel 
+	// reconfigures its sound source, and the evicted track stops using it once its next request for
+	// that track channel is denied or moved to another channel
+	return SoundVoiceAllocator::allocate(&soundVoiceRequest, &evictedRequesterId);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 uint32 SoundTrack::getTicks()
 {
 	return this->ticks;
@@ -192,9 +283,33 @@ void SoundTrack::updateCursors()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+uint8 SoundTrack::getTrackChannels()
+{
+	return 1;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+uint8 SoundTrack::getChannelMask(uint8 trackChannel __attribute__((unused)))
+{
+	return __SOUND_VOICE_ALLOCATOR_ALL_CHANNELS;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void SoundTrack::saveCursors(uint32* cursors __attribute__((unused)))
+{}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void SoundTrack::restoreCursors(const uint32* cursors __attribute__((unused)))
+{}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void SoundTrack::sendSoundRequest
 (
-	fix7_9_ext targetTimerResolutionFactor __attribute__((unused)), uint8 maximumVolume __attribute__((unused)),
+	const int8* channels __attribute__((unused)), fix7_9_ext targetTimerResolutionFactor __attribute__((unused)), uint8 maximumVolume __attribute__((unused)),
 	uint8 leftVolumeReduction __attribute__((unused)), uint8 rightVolumeReduction __attribute__((unused)),
 	uint8 volumeReduction __attribute__((unused)), uint16 frequencyDelta __attribute__((unused))
 )
@@ -202,6 +317,79 @@ void SoundTrack::sendSoundRequest
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static SoundTrackSeekIndex* SoundTrack::findSeekIndex(const SoundTrackSpec* soundTrackSpec)
+{
+	for(int16 i = 0; i < __SOUND_TRACK_SEEK_INDEXES; i++)
+	{
+		if(soundTrackSpec == _seekIndexes[i].soundTrackSpec)
+		{
+			return &_seekIndexes[i];
+		}
+	}
+
+	return NULL;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void SoundTrack::compactSeekIndexes()
+{
+	// Drop the indexes that no track uses anymore
+	for(int16 i = 0; i < __SOUND_TRACK_SEEK_INDEXES; i++)
+	{
+		if(NULL != _seekIndexes[i].soundTrackSpec && 0 == _seekIndexes[i].usageCount)
+		{
+			_seekIndexes[i].soundTrackSpec = NULL;
+		}
+	}
+
+	uint16 usedCheckpoints = 0;
+
+	// Move the checkpoints of the remaining ones to the start of the table, in the order they are laid out
+	for(;;)
+	{
+		SoundTrackSeekIndex* seekIndex = NULL;
+
+		for(int16 i = 0; i < __SOUND_TRACK_SEEK_INDEXES; i++)
+		{
+			if
+			(
+				NULL != _seekIndexes[i].soundTrackSpec 
+				&& 
+				usedCheckpoints <= _seekIndexes[i].firstCheckpoint
+				&&
+				(NULL == seekIndex || seekIndex->firstCheckpoint > _seekIndexes[i].firstCheckpoint)
+			)
+			{
+				seekIndex = &_seekIndexes[i];
+			}
+		}
+
+		if(NULL == seekIndex)
+		{
+			break;
+		}
+
+		for(uint16 i = 0; i < seekIndex->totalCheckpoints; i++)
+		{
+			_checkpoints[usedCheckpoints + i] = _checkpoints[seekIndex->firstCheckpoint + i];
+		}
+
+		seekIndex->firstCheckpoint = usedCheckpoints;
+		usedCheckpoints += seekIndex->totalCheckpoints;
+	}
+
+	_usedCheckpoints = usedCheckpoints;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' PRIVATE METHODS
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -219,6 +407,7 @@ void SoundTrack::constructor(const SoundTrackSpec* soundTrackSpec)
 	this->soundTrackSpec = soundTrackSpec;
 	this->samples = 0;
 	this->ticks = 0;
+	this->seekIndex = NULL;
 
 	SoundTrack::reset(this);
 	SoundTrack::computeLength(this);
@@ -229,6 +418,13 @@ void SoundTrack::constructor(const SoundTrackSpec* soundTrackSpec)
 void SoundTrack::destructor()
 {
 	SoundTrack::stop(this);
+
+	// The index is kept for the next track that plays the same spec
+	if(NULL != this->seekIndex)
+	{
+		this->seekIndex->usageCount--;
+		this->seekIndex = NULL;
+	}
 	
 	// Always explicitly call the base's destructor 
 	Base::destructor();
@@ -262,10 +458,26 @@ void SoundTrack::computeLength()
 
 fix7_9_ext SoundTrack::fastForward(uint32 cursor)
 {
-	SoundTrack::reset(this);
-
 	fix7_9_ext elapsedTicks = 0;
 
+	if(NULL != this->seekIndex)
+	{
+		// Resume from the closest checkpoint behind the cursor
+		uint32 checkpoint = cursor / this->seekIndex->checkpointInterval;
+
+		if(this->seekIndex->totalCheckpoints <= checkpoint)
+		{
+			checkpoint = this->seekIndex->totalCheckpoints - 1;
+		}
+
+		elapsedTicks = 
+			SoundTrack::restoreCheckpoint(this, &_checkpoints[this->seekIndex->firstCheckpoint + checkpoint]);
+	}
+	else
+	{
+		SoundTrack::reset(this);
+	}
+
 	for(; this->cursor < cursor;)
 	{
 		SoundTrackKeyframe soundTrackKeyframe = this->soundTrackSpec->trackKeyframes[this->cursor];
@@ -281,3 +493,207 @@ fix7_9_ext SoundTrack::fastForward(uint32 cursor)
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void SoundTrack::acquireSeekIndex()
+{
+	if(NULL != this->seekIndex || NULL == this->soundTrackSpec || NULL == this->soundTrackSpec->trackKeyframes)
+	{
+		return;
+	}
+
+	// Checkpoints cannot capture cursors that the implementation does not expose
+	if(SoundTrack::overrides(this, updateCursors) && !SoundTrack::overrides(this, restoreCursors))
+	{
+		return;
+	}
+
+	// The index is built once per spec and shared by all the tracks that play it
+	SoundTrackSeekIndex* seekIndex = SoundTrack::findSeekIndex(this->soundTrackSpec);
+
+	if(NULL != seekIndex)
+	{
+		seekIndex->usageCount++;
+		this->seekIndex = seekIndex;
+		return;
+	}
+
+	seekIndex = SoundTrack::findSeekIndex(NULL);
+
+	if(NULL == seekIndex || __SOUND_TRACK_SEEK_INDEX_CHECKPOINTS - _usedCheckpoints < this->samples / __SOUND_TRACK_CHECKPOINT_INTERVAL + 1)
+	{
+		SoundTrack::compactSeekIndexes();
+		seekIndex = SoundTrack::findSeekIndex(NULL);
+	}
+
+	if(NULL == seekIndex)
+	{
+		return;
+	}
+
+	// Long tracks get sparser checkpoints, but never so sparse that a seek replays more than 
+	// __SOUND_TRACK_MAXIMUM_CHECKPOINT_INTERVAL keyframes
+	uint16 availableCheckpoints = __SOUND_TRACK_SEEK_INDEX_CHECKPOINTS - _usedCheckpoints;
+	uint16 checkpointInterval = __SOUND_TRACK_CHECKPOINT_INTERVAL;
+
+	while
+	(
+		__SOUND_TRACK_MAXIMUM_CHECKPOINT_INTERVAL > checkpointInterval 
+		&& 
+		availableCheckpoints < this->samples / checkpointInterval + 1
+	)
+	{
+		checkpointInterval <<= 1;
+	}
+
+	NM_ASSERT
+	(
+		availableCheckpoints >= this->samples / checkpointInterval + 1, 
+		"SoundTrack::acquireSeekIndex: increase __SOUND_TRACK_SEEK_INDEX_CHECKPOINTS"
+	);
+
+	if(availableCheckpoints < this->samples / checkpointInterval + 1)
+	{
+		return;
+	}
+
+	seekIndex->soundTrackSpec = this->soundTrackSpec;
+	seekIndex->firstCheckpoint = _usedCheckpoints;
+	seekIndex->totalCheckpoints = this->samples / checkpointInterval + 1;
+	seekIndex->checkpointInterval = checkpointInterval;
+	seekIndex->usageCount = 1;
+
+	// No keyframe matches it unless the loop point is reached while building the index
+	seekIndex->loopCheckpoint.cursor = 0xFFFFFFFF;
+
+	_usedCheckpoints += seekIndex->totalCheckpoints;
+
+	SoundTrack::buildSeekIndex(this, seekIndex);
+
+	this->seekIndex = seekIndex;
+
+#ifdef __DEBUG
+	SoundTrack::checkSeekIndex(this);
+#endif
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void SoundTrack::buildSeekIndex(SoundTrackSeekIndex* seekIndex)
+{
+	SoundTrack::reset(this);
+
+	fix7_9_ext elapsedTicks = 0;
+	uint16 checkpoint = 0;
+
+	// Replay the whole track once, as fastForward would do it
+	for(;; this->cursor++)
+	{
+		if(this->soundTrackSpec->loopPointCursor == this->cursor)
+		{
+			SoundTrack::saveCheckpoint(this, &seekIndex->loopCheckpoint, elapsedTicks);
+		}
+
+		if(0 == this->cursor % seekIndex->checkpointInterval && checkpoint < seekIndex->totalCheckpoints)
+		{
+			SoundTrack::saveCheckpoint(this, &_checkpoints[seekIndex->firstCheckpoint + checkpoint++], elapsedTicks);
+		}
+
+		if(this->cursor >= this->samples)
+		{
+			break;
+		}
+
+		SoundTrackKeyframe soundTrackKeyframe = this->soundTrackSpec->trackKeyframes[this->cursor];
+
+		SoundTrack::updateCursors(this);
+
+		elapsedTicks += __I_TO_FIX7_9_EXT(soundTrackKeyframe.tick);
+	}
+
+	SoundTrack::reset(this);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#ifdef __DEBUG
+void SoundTrack::checkSeekIndex()
+{
+	SoundTrack::reset(this);
+
+	fix7_9_ext elapsedTicks = 0;
+	uint16 probeOffset = this->seekIndex->checkpointInterval >> 1;
+
+	// Play the track sequentially and check that seeking to the keyframes halfway between checkpoints,
+	// and to the loop point, lands on the very same state
+	for(;; this->cursor++)
+	{
+		if
+		(
+			probeOffset == this->cursor % this->seekIndex->checkpointInterval 
+			|| 
+			this->soundTrackSpec->loopPointCursor == this->cursor
+			||
+			this->samples == this->cursor
+		)
+		{
+			SoundTrackCheckpoint sequential = {0, 0, {0}};
+			SoundTrackCheckpoint seek = {0, 0, {0}};
+
+			SoundTrack::saveCheckpoint(this, &sequential, elapsedTicks);
+			
+			fix7_9_ext seekElapsedTicks = this->soundTrackSpec->loopPointCursor == this->cursor ? 
+				SoundTrack::loop(this) : SoundTrack::seek(this, sequential.cursor);
+
+			SoundTrack::saveCheckpoint(this, &seek, seekElapsedTicks);
+
+			ASSERT(sequential.cursor == seek.cursor, "SoundTrack::checkSeekIndex: seek cursor mismatch");
+			ASSERT(sequential.elapsedTicks == seek.elapsedTicks, "SoundTrack::checkSeekIndex: seek ticks mismatch");
+
+			for(int16 i = 0; i < __SOUND_TRACK_CHECKPOINT_CURSORS; i++)
+			{
+				ASSERT(sequential.cursors[i] == seek.cursors[i], "SoundTrack::checkSeekIndex: seek cursors mismatch");
+			}
+
+			SoundTrack::restoreCheckpoint(this, &sequential);
+		}
+
+		if(this->cursor >= this->samples)
+		{
+			break;
+		}
+
+		SoundTrackKeyframe soundTrackKeyframe = this->soundTrackSpec->trackKeyframes[this->cursor];
+
+		SoundTrack::updateCursors(this);
+
+		elapsedTicks += __I_TO_FIX7_9_EXT(soundTrackKeyframe.tick);
+	}
+
+	SoundTrack::reset(this);
+}
+#endif
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void SoundTrack::saveCheckpoint(SoundTrackCheckpoint* checkpoint, fix7_9_ext elapsedTicks)
+{
+	checkpoint->cursor = this->cursor;
+	checkpoint->elapsedTicks = elapsedTicks;
+
+	SoundTrack::saveCursors(this, checkpoint->cursors);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+fix7_9_ext SoundTrack::restoreCheckpoint(const SoundTrackCheckpoint* checkpoint)
+{
+	SoundTrack::reset(this);
+
+	this->cursor = checkpoint->cursor;
+
+	SoundTrack::restoreCursors(this, checkpoint->cursors);
+
+	return checkpoint->elapsedTicks;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -15,6 +15,41 @@
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 #include <Object.h>
+#include <SoundVoiceAllocator.h>
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Maximum number of own channels that a track can play at once
+#ifndef __SOUND_TRACK_MAXIMUM_CHANNELS
+#define __SOUND_TRACK_MAXIMUM_CHANNELS				__SOUND_VOICE_ALLOCATOR_CHANNELS
+#endif
+
+/// Keyframes between checkpoints for tracks whose seek index has room enough
+#ifndef __SOUND_TRACK_CHECKPOINT_INTERVAL
+#define __SOUND_TRACK_CHECKPOINT_INTERVAL			32
+#endif
+
+/// Upper bound of the keyframes replayed by a seek; the interval between checkpoints
+/// never grows beyond it
+#ifndef __SOUND_TRACK_MAXIMUM_CHECKPOINT_INTERVAL
+#define __SOUND_TRACK_MAXIMUM_CHECKPOINT_INTERVAL	256
+#endif
+
+#ifndef __SOUND_TRACK_CHECKPOINT_CURSORS
+#define __SOUND_TRACK_CHECKPOINT_CURSORS			4
+#endif
+
+/// Number of sound track specs whose seek index is kept at once
+#ifndef __SOUND_TRACK_SEEK_INDEXES
+#define __SOUND_TRACK_SEEK_INDEXES					8
+#endif
+
+/// Checkpoints shared by all the seek indexes
+#ifndef __SOUND_TRACK_SEEK_INDEX_CHECKPOINTS
+#define __SOUND_TRACK_SEEK_INDEX_CHECKPOINTS		128
+#endif
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DATA
@@ -40,6 +75,21 @@ typedef struct SoundTrackKeyframe
 
 } SoundTrackKeyframe;
 
+/// Playback state at a given keyframe, used to seek without replaying the track from its start
+/// @memberof SoundTrack
+typedef struct SoundTrackCheckpoint
+{
+	/// Keyframe at which the checkpoint was taken
+	uint32 cursor;
+
+	/// Ticks from the beginning of the track up to the keyframe
+	fix7_9_ext elapsedTicks;
+
+	/// Cursors that the track's implementation keeps
+	uint32 cursors[__SOUND_TRACK_CHECKPOINT_CURSORS];
+
+} SoundTrackCheckpoint;
+
 /// A Sound Track
 /// @memberof SoundTrack
 typedef struct SoundTrackSpec
@@ -65,6 +115,30 @@ typedef struct SoundTrackSpec
 /// @memberof SoundTrack
 typedef const SoundTrackSpec SoundTrackROMSpec;
 
+/// Checkpoints of a sound track spec, shared by all the tracks that play it
+/// @memberof SoundTrack
+typedef struct SoundTrackSeekIndex
+{
+	/// Spec whose keyframes the checkpoints were taken from; NULL if the index is free
+	const SoundTrackSpec* soundTrackSpec;
+
+	/// Checkpoint taken at the loop point
+	SoundTrackCheckpoint loopCheckpoint;
+
+	/// Index of the first checkpoint in the shared checkpoints table
+	uint16 firstCheckpoint;
+
+	/// Number of checkpoints
+	uint16 totalCheckpoints;
+
+	/// Keyframes between checkpoints
+	uint16 checkpointInterval;
+
+	/// Number of tracks using the index
+	uint16 usageCount;
+
+} SoundTrackSeekIndex;
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DECLARATION
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -99,6 +173,9 @@ abstract class SoundTrack : Object
 	/// Next ticks target
 	fix7_9_ext nextElapsedTicksTarget;
 
+	/// Checkpoints of the track's spec; NULL if the track seeks by replaying it from its start
+	SoundTrackSeekIndex* seekIndex;
+
 	/// If true, the playback is complete
 	bool finished;
 
@@ -134,6 +211,11 @@ abstract class SoundTrack : Object
 	/// @return Total elapsed ticks from the beginning of the track to the looping cursor's position
 	fix7_9_ext loop();
 
+	/// Move the playback to the provided keyframe.
+	/// @param cursor: Keyframe to move the playback to
+	/// @return Total elapsed ticks from the beginning of the track to the cursor's position
+	fix7_9_ext seek(uint32 cursor);
+
 	/// Advance the playback on the sound's MIDI tracks.
 	/// @param tickStep: Tick step per timer interrupt
 	/// @param targetTimerResolutionFactor: Factor to apply to the tick step
@@ -149,6 +231,14 @@ abstract class SoundTrack : Object
 		uint8 rightVolumeReduction, uint8 volumeReduction, uint16 frequencyDelta
 	);
 
+	/// Request a sound channel for one of the track's own channels. Called by update for each of the
+	/// track's channels on every keyframe.
+	/// @param trackChannel: Index of the track's own channel that needs to be played
+	/// @param channelMask: Bit mask of the sound channels that can play it
+	/// @param audibility: Volume at which the track is heard once attenuated
+	/// @return Index of the allocated channel; __SOUND_VOICE_ALLOCATOR_NO_CHANNEL if none could be had
+	int8 requestVoice(uint8 trackChannel, uint8 channelMask, uint8 audibility);
+
 	/// Retrieve the sound track's total ticks.
 	/// @return Total number of ticks
 	uint32 getTicks();
@@ -177,7 +267,27 @@ abstract class SoundTrack : Object
 	/// Update the sound track cursors.
 	virtual void updateCursors();	
 
-	/// Send the sound request to the sound unit.
+	/// Retrieve the number of own channels that the track plays at once.
+	/// @return Number of track channels (up to __SOUND_TRACK_MAXIMUM_CHANNELS)
+	virtual uint8 getTrackChannels();
+
+	/// Retrieve the sound channels that can play one of the track's own channels.
+	/// @param trackChannel: Index of the track's own channel
+	/// @return Bit mask of the sound channels that can play it
+	virtual uint8 getChannelMask(uint8 trackChannel);
+
+	/// Save the cursors that the implementation keeps besides the keyframe cursor. Implementations
+	/// that override updateCursors must override this and restoreCursors for seeks to use checkpoints.
+	/// @param cursors: Array of __SOUND_TRACK_CHECKPOINT_CURSORS elements to save the cursors to
+	virtual void saveCursors(uint32* cursors);
+
+	/// Restore the cursors saved by saveCursors.
+	/// @param cursors: Array of __SOUND_TRACK_CHECKPOINT_CURSORS elements to restore the cursors from
+	virtual void restoreCursors(const uint32* cursors);
+
+	/// Send the sound request to the sound unit through the granted sound channels.
+	/// @param channels: Sound channel granted to each of the track's own channels; 
+	/// __SOUND_VOICE_ALLOCATOR_NO_CHANNEL for those that must not be played
 	/// @param targetTimerResolutionFactor: Factor to apply to the tick step
 	/// @param maximumVolume: Maximum volume for the sound track's playback
 	/// @param leftVolumeReduction: Volume reduction to apply to the left speaker's volume
@@ -187,7 +297,7 @@ abstract class SoundTrack : Object
 	/// @return True if the playback is complete; false otherwise
 	virtual void sendSoundRequest
 	(
-		fix7_9_ext targetTimerResolutionFactor, uint8 maximumVolume, uint8 leftVolumeReduction,
+		const int8* channels, fix7_9_ext targetTimerResolutionFactor, uint8 maximumVolume, uint8 leftVolumeReduction,
 		uint8 rightVolumeReduction, uint8 volumeReduction, uint16 frequencyDelta
 	);
 }
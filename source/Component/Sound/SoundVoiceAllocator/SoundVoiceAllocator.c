@@ -0,0 +1,297 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <DebugConfig.h>
+#include <Printer.h>
+
+#include "SoundVoiceAllocator.h"
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' ATTRIBUTES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static SoundVoice _voices[__SOUND_VOICE_ALLOCATOR_CHANNELS];
+static SoundVoiceStatistics _statistics[__SOUND_VOICE_ALLOCATOR_CHANNELS];
+static uint32 _droppedRequests = 0;
+static uint32 _ticks = 0;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PUBLIC STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void SoundVoiceAllocator::reset()
+{
+	for(int16 i = 0; i < __SOUND_VOICE_ALLOCATOR_CHANNELS; i++)
+	{
+		_voices[i].requesterId = 0;
+		_voices[i].age = 0;
+		_voices[i].trackChannel = 0;
+		_voices[i].priority = 0;
+		_voices[i].audibility = 0;
+		_voices[i].active = false;
+
+		_statistics[i].occupiedTicks = 0;
+		_statistics[i].allocations = 0;
+		_statistics[i].steals = 0;
+	}
+
+	_droppedRequests = 0;
+	_ticks = 0;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static int8 SoundVoiceAllocator::allocate(const SoundVoiceRequest* soundVoiceRequest, uint32* evictedRequesterId)
+{
+	if(NULL == soundVoiceRequest)
+	{
+		return __SOUND_VOICE_ALLOCATOR_NO_CHANNEL;
+	}
+
+	int8 freeChannel = __SOUND_VOICE_ALLOCATOR_NO_CHANNEL;
+	int8 victimChannel = __SOUND_VOICE_ALLOCATOR_NO_CHANNEL;
+
+	for(int8 i = 0; i < __SOUND_VOICE_ALLOCATOR_CHANNELS; i++)
+	{
+		if(0 == (soundVoiceRequest->channelMask & (1 << i)))
+		{
+			continue;
+		}
+
+		SoundVoice* voice = &_voices[i];
+
+		if(!voice->active)
+		{
+			if(__SOUND_VOICE_ALLOCATOR_NO_CHANNEL == freeChannel)
+			{
+				freeChannel = i;
+			}
+
+			continue;
+		}
+
+		// The requester's channel already owns a suitable voice
+		if
+		(
+			soundVoiceRequest->requesterId == voice->requesterId 
+			&& 
+			soundVoiceRequest->trackChannel == voice->trackChannel
+		)
+		{
+			voice->priority = soundVoiceRequest->priority;
+			voice->audibility = soundVoiceRequest->audibility;
+
+			return i;
+		}
+
+		if(__SOUND_VOICE_ALLOCATOR_NO_CHANNEL == victimChannel || SoundVoiceAllocator::isLessImportant(voice, &_voices[victimChannel]))
+		{
+			victimChannel = i;
+		}
+	}
+
+	if(__SOUND_VOICE_ALLOCATOR_NO_CHANNEL != freeChannel)
+	{
+		SoundVoiceAllocator::assign(freeChannel, soundVoiceRequest);
+
+		return freeChannel;
+	}
+
+	if(__SOUND_VOICE_ALLOCATOR_NO_CHANNEL == victimChannel)
+	{
+		_droppedRequests++;
+
+		return __SOUND_VOICE_ALLOCATOR_NO_CHANNEL;
+	}
+
+	SoundVoice* victim = &_voices[victimChannel];
+
+	// Inaudible voices are given away to any audible request, otherwise the request must be more important
+	bool steal = 
+		(0 == victim->audibility && 0 < soundVoiceRequest->audibility)
+		||
+		victim->priority < soundVoiceRequest->priority
+		||
+		(victim->priority == soundVoiceRequest->priority && victim->audibility < soundVoiceRequest->audibility);
+
+	if(!steal)
+	{
+		_droppedRequests++;
+
+		return __SOUND_VOICE_ALLOCATOR_NO_CHANNEL;
+	}
+
+	if(NULL != evictedRequesterId)
+	{
+		*evictedRequesterId = victim->requesterId;
+	}
+
+	_statistics[victimChannel].steals++;
+
+	SoundVoiceAllocator::assign(victimChannel, soundVoiceRequest);
+
+	return victimChannel;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void SoundVoiceAllocator::release(uint32 requesterId)
+{
+	for(int16 i = 0; i < __SOUND_VOICE_ALLOCATOR_CHANNELS; i++)
+	{
+		if(_voices[i].active && requesterId == _voices[i].requesterId)
+		{
+			_voices[i].active = false;
+		}
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void SoundVoiceAllocator::setAudibility(uint32 requesterId, uint8 audibility)
+{
+	for(int16 i = 0; i < __SOUND_VOICE_ALLOCATOR_CHANNELS; i++)
+	{
+		if(_voices[i].active && requesterId == _voices[i].requesterId)
+		{
+			_voices[i].audibility = audibility;
+		}
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void SoundVoiceAllocator::update()
+{
+	_ticks++;
+
+	for(int16 i = 0; i < __SOUND_VOICE_ALLOCATOR_CHANNELS; i++)
+	{
+		if(_voices[i].active)
+		{
+			_voices[i].age++;
+			_statistics[i].occupiedTicks++;
+		}
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static const SoundVoice* SoundVoiceAllocator::getVoice(int8 channel)
+{
+	if(0 > channel || __SOUND_VOICE_ALLOCATOR_CHANNELS <= channel)
+	{
+		return NULL;
+	}
+
+	return &_voices[channel];
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static const SoundVoiceStatistics* SoundVoiceAllocator::getStatistics(int8 channel)
+{
+	if(0 > channel || __SOUND_VOICE_ALLOCATOR_CHANNELS <= channel)
+	{
+		return NULL;
+	}
+
+	return &_statistics[channel];
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint32 SoundVoiceAllocator::getDroppedRequests()
+{
+	return _droppedRequests;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void SoundVoiceAllocator::print(int32 x, int32 y)
+{
+	Printer::text("SOUND VOICES", x, y++, NULL);
+	y++;
+
+	Printer::text("Dropped:      ", x, y, NULL);
+	Printer::int32(_droppedRequests, x + 12, y++, NULL);
+	y++;
+
+	Printer::text("Ch Own  Pr Au Use% Allc Stls", x, y++, NULL);
+
+	for(int16 i = 0; i < __SOUND_VOICE_ALLOCATOR_CHANNELS; i++)
+	{
+		Printer::int32(i + 1, x, y, NULL);
+
+		if(_voices[i].active)
+		{
+			Printer::int32(_voices[i].requesterId, x + 3, y, NULL);
+			Printer::int32(_voices[i].priority, x + 8, y, NULL);
+			Printer::int32(_voices[i].audibility, x + 11, y, NULL);
+		}
+		else
+		{
+			Printer::text("-", x + 3, y, NULL);
+		}
+
+		Printer::int32(0 < _ticks ? _statistics[i].occupiedTicks * 100 / _ticks : 0, x + 14, y, NULL);
+		Printer::int32(_statistics[i].allocations, x + 19, y, NULL);
+		Printer::int32(_statistics[i].steals, x + 24, y++, NULL);
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static bool SoundVoiceAllocator::isLessImportant(const SoundVoice* voice, const SoundVoice* otherVoice)
+{
+	if((0 == voice->audibility) != (0 == otherVoice->audibility))
+	{
+		return 0 == voice->audibility;
+	}
+
+	if(voice->priority != otherVoice->priority)
+	{
+		return voice->priority < otherVoice->priority;
+	}
+
+	if(voice->audibility != otherVoice->audibility)
+	{
+		return voice->audibility < otherVoice->audibility;
+	}
+
+	return voice->age > otherVoice->age;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void SoundVoiceAllocator::assign(int8 channel, const SoundVoiceRequest* soundVoiceRequest)
+{
+	_voices[channel].requesterId = soundVoiceRequest->requesterId;
+	_voices[channel].age = 0;
+	_voices[channel].trackChannel = soundVoiceRequest->trackChannel;
+	_voices[channel].priority = soundVoiceRequest->priority;
+	_voices[channel].audibility = soundVoiceRequest->audibility;
+	_voices[channel].active = true;
+
+	_statistics[channel].allocations++;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
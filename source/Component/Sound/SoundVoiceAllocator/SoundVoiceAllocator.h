@@ -0,0 +1,152 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+#ifndef SOUND_VOICE_ALLOCATOR_H_
+#define SOUND_VOICE_ALLOCATOR_H_
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <Object.h>
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#ifndef __SOUND_VOICE_ALLOCATOR_CHANNELS
+#define __SOUND_VOICE_ALLOCATOR_CHANNELS			6
+#endif
+
+#define __SOUND_VOICE_ALLOCATOR_NO_CHANNEL			-1
+#define __SOUND_VOICE_ALLOCATOR_ALL_CHANNELS		((1 << __SOUND_VOICE_ALLOCATOR_CHANNELS) - 1)
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DATA
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Request for a sound channel
+/// @memberof SoundVoiceAllocator
+typedef struct SoundVoiceRequest
+{
+	/// Id of the sound track that requests the channel
+	uint32 requesterId;
+
+	/// Index of the sound track's own channel that needs to be played
+	uint8 trackChannel;
+
+	/// Bit mask of the channels that can play the request
+	uint8 channelMask;
+
+	/// Priority of the request, higher values displace lower ones
+	uint8 priority;
+
+	/// Volume at which the request will be heard once attenuated
+	uint8 audibility;
+
+} SoundVoiceRequest;
+
+/// A sound channel's voice
+/// @memberof SoundVoiceAllocator
+typedef struct SoundVoice
+{
+	/// Id of the sound track that owns the channel
+	uint32 requesterId;
+
+	/// Ticks since the channel was allocated
+	uint32 age;
+
+	/// Index of the owner's own channel that the channel plays
+	uint8 trackChannel;
+
+	/// Priority of the owner's request
+	uint8 priority;
+
+	/// Volume at which the owner is heard once attenuated
+	uint8 audibility;
+
+	/// If true, the channel is in use
+	bool active;
+
+} SoundVoice;
+
+/// Usage statistics of a sound channel
+/// @memberof SoundVoiceAllocator
+typedef struct SoundVoiceStatistics
+{
+	/// Ticks during which the channel was in use
+	uint32 occupiedTicks;
+
+	/// Number of times that the channel was allocated
+	uint16 allocations;
+
+	/// Number of times that the channel was taken from its owner
+	uint16 steals;
+
+} SoundVoiceStatistics;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DECLARATION
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Class SoundVoiceAllocator
+///
+/// Inherits from Object
+///
+/// Assigns the sound unit's channels to the sound tracks that request them. When all the eligible
+/// channels are busy, the request takes the channel of the least important voice if it is more important
+/// than it. Voices that cannot be heard are the least important ones and are given away to any audible
+/// request; then come those with the lowest priority, the quietest ones among those and the oldest ones
+/// among those. It does not touch the hardware, so the sound unit must silence the evicted voices.
+static class SoundVoiceAllocator : Object
+{
+	/// @publicsection
+
+	/// Release all the channels and reset the statistics.
+	static void reset();
+
+	/// Allocate a channel for the provided request.
+	/// @param soundVoiceRequest: Request to allocate a channel for
+	/// @param evictedRequesterId: Set to the id of the sound track whose channel was taken, if any
+	/// @return Index of the allocated channel; __SOUND_VOICE_ALLOCATOR_NO_CHANNEL if the request was dropped
+	static int8 allocate(const SoundVoiceRequest* soundVoiceRequest, uint32* evictedRequesterId);
+
+	/// Release the channels allocated for the provided sound track.
+	/// @param requesterId: Id of the sound track that owns the channels
+	static void release(uint32 requesterId);
+
+	/// Update the audibility of the channels allocated for the provided sound track.
+	/// @param requesterId: Id of the sound track that owns the channels
+	/// @param audibility: Volume at which the sound track is heard once attenuated
+	static void setAudibility(uint32 requesterId, uint8 audibility);
+
+	/// Age the allocated channels and accumulate their occupancy.
+	static void update();
+
+	/// Retrieve a channel's voice.
+	/// @param channel: Index of the channel
+	/// @return Pointer to the channel's voice; NULL if the index is invalid
+	static const SoundVoice* getVoice(int8 channel);
+
+	/// Retrieve a channel's usage statistics.
+	/// @param channel: Index of the channel
+	/// @return Pointer to the channel's statistics; NULL if the index is invalid
+	static const SoundVoiceStatistics* getStatistics(int8 channel);
+
+	/// Retrieve the number of requests that could not get a channel.
+	/// @return Number of dropped requests
+	static uint32 getDroppedRequests();
+
+	/// Print the channels' statistics.
+	/// @param x: Screen x coordinate where to print
+	/// @param y: Screen y coordinate where to print
+	static void print(int32 x, int32 y);
+}
+
+#endif
@@ -62,6 +62,8 @@ void Sprite::constructor(Entity owner, const SpriteSpec* spriteSpec)
 	this->scale = (PixelScale){__1I_FIX7_9, __1I_FIX7_9};
 	this->displacement = PixelVector::zero();
 	this->hasTextures = true;
+	this->projected = false;
+	this->relativePosition = Vector3D::zero();
 
 	if(NULL != spriteSpec)
 	{
@@ -360,6 +362,42 @@ bool Sprite::isHidden()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+bool Sprite::isWithinScreenSpace()
+{
+	if
+	(
+		!(
+			(unsigned)(this->position.x + this->displacement.x - (_cameraFrustum->x0 - this->halfWidth)) 
+			< 
+			(unsigned)(_cameraFrustum->x1 + this->halfWidth - (_cameraFrustum->x0 - this->halfWidth))
+		)
+	)
+	{
+		return false;
+	}
+
+	if
+	(
+		!(
+			(unsigned)(this->position.y + this->displacement.y - (_cameraFrustum->y0 - this->halfHeight)) 
+			< 
+			(unsigned)(_cameraFrustum->y1 + this->halfHeight - (_cameraFrustum->y0 - this->halfHeight))
+		)
+	)
+	{
+		return false;
+	}
+/*
+	if(!((unsigned)(this->position.z + this->displacement.z - _cameraFrustum->z0) < (unsigned)(_cameraFrustum->z1 - _cameraFrustum->z0)))
+	{
+		return false;
+	}
+*/
+	return true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void Sprite::setPosition(const PixelVector* position)
 {
 	if(NULL == position)
@@ -466,6 +504,7 @@ void Sprite::loadTexture(ClassPointer textureClass)
 void Sprite::invalidateRendering()
 {
 	this->rendered = false;
+	this->projected = false;
 	Sprite::transform(this);
 }
 
@@ -568,12 +607,22 @@ void Sprite::position()
 	}
 
 #else
-	PixelVector position = 
-		PixelVector::projectVector3D(Vector3D::sub(this->transformation->position, *_cameraPosition), this->position.parallax);
+	Vector3D relativePosition = Vector3D::sub(this->transformation->position, *_cameraPosition);
+
+	// Neither the owner nor the camera have moved, so the projection would yield the same position
+	if(this->projected && Vector3D::areEqual(relativePosition, this->relativePosition))
+	{
+		return;
+	}
+
+	this->projected = true;
+	this->relativePosition = relativePosition;
+
+	PixelVector position = PixelVector::projectVector3D(relativePosition, this->position.parallax);
 
 	if(position.z != this->position.z)
 	{
-		position.parallax = Optics::calculateParallax(this->transformation->position.z - _cameraPosition->z);
+		position.parallax = Optics::calculateParallax(relativePosition.z);
 
 		this->scale.x = this->scale.y = 0;
 	}
@@ -648,38 +697,3 @@ void Sprite::update()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-bool Sprite::isWithinScreenSpace()
-{
-	if
-	(
-		!(
-			(unsigned)(this->position.x + this->displacement.x - (_cameraFrustum->x0 - this->halfWidth)) 
-			< 
-			(unsigned)(_cameraFrustum->x1 + this->halfWidth - (_cameraFrustum->x0 - this->halfWidth))
-		)
-	)
-	{
-		return false;
-	}
-
-	if
-	(
-		!(
-			(unsigned)(this->position.y + this->displacement.y - (_cameraFrustum->y0 - this->halfHeight)) 
-			< 
-			(unsigned)(_cameraFrustum->y1 + this->halfHeight - (_cameraFrustum->y0 - this->halfHeight))
-		)
-	)
-	{
-		return false;
-	}
-/*
-	if(!((unsigned)(this->position.z + this->displacement.z - _cameraFrustum->z0) < (unsigned)(_cameraFrustum->z1 - _cameraFrustum->z0)))
-	{
-		return false;
-	}
-*/
-	return true;
-}
-
-//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -63,6 +63,9 @@ abstract class Sprite : VisualComponent
 	/// Flag for special sprites
 	bool hasTextures : 1;
 
+	/// Flag raised once the position cache has been projected from relativePosition
+	bool projected : 1;
+
 	/// Index of the block in DRAM that the sprite configures to
 	/// display its texture
 	int16 index;
@@ -82,6 +85,9 @@ abstract class Sprite : VisualComponent
 	/// Position cache
 	PixelVector position;
 
+	/// Position relative to the camera from which the position cache was projected
+	Vector3D relativePosition;
+
 	/// Displacement added to the sprite's position
 	PixelVector displacement;
 
@@ -142,6 +148,10 @@ abstract class Sprite : VisualComponent
 	/// @return True if the sprite is hidden; false otherwise
 	bool isHidden();
 
+	/// Check if the sprite's last projected position falls within the camera's frustum.
+	/// @return True if the sprite is within the screen space; false otherwise
+	bool isWithinScreenSpace();
+
 	/// Set the position cache.
 	/// @param position: Position cache to save
 	void setPosition(const PixelVector* position);
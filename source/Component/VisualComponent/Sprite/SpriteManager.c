@@ -13,16 +13,21 @@
 
 #include <string.h>
 
+#include <BgmapSpaceAllocator.h>
 #include <TileSetManager.h>
 #include <Clock.h>
 #include <DebugConfig.h>
+#include <IdleScheduler.h>
 #include <Mem.h>
 #include <ParamTableManager.h>
 #include <Printer.h>
+#include <Profiler.h>
 #include <Sprite.h>
 #include <TextureManager.h>
+#include <TextureUploadQueue.h>
 #include <VirtualList.h>
 #include <VirtualNode.h>
+#include <VUEngine.h>
 #include <DisplayUnit.h>
 
 #include "SpriteManager.h"
@@ -86,6 +91,8 @@ void SpriteManager::constructor()
 
 void SpriteManager::destructor()
 {
+	IdleScheduler::unregisterJob(Object::safeCast(this), NULL);
+
 	SpriteManager::stopListeningForVBlank(this);
 
 	if(!isDeleted(this->specialSprites))
@@ -117,8 +124,16 @@ bool SpriteManager::onEvent(ListenerObject eventFirer, uint16 eventCode)
 	{
 		case kEventDisplayUnitVBlank:
 		{
+#ifdef __ENABLE_PROFILER
+			Profiler::lap(kProfilerLapTypeStartInterrupt, NULL);
+#endif
+
 			SpriteManager::commitGraphics(this);
-		
+
+#ifdef __ENABLE_PROFILER
+			Profiler::lap(kProfilerLapTypeVIPInterruptXPENDProcess, PROCESS_NAME_VRAM_WRITE);
+#endif
+
 			return true;
 		}
 	}
@@ -146,6 +161,10 @@ void SpriteManager::enable()
 	TileSetManager::reset(TileSetManager::getInstance());
 	ParamTableManager::reset(ParamTableManager::getInstance());
 
+#ifdef __ENABLE_BGMAP_SPACE_ALLOCATOR
+	BgmapSpaceAllocator::reset();
+#endif
+
 	for(int16 i = 0; i < __TOTAL_SPRITE_LISTS; i++)
 	{
 		NM_ASSERT(NULL == this->spriteRegistry[i].sprites, "SpriteManager::enable: invalid sprites list");
@@ -157,12 +176,16 @@ void SpriteManager::enable()
 
 	this->completeSort = true;
 	this->evenFrame = __TRANSPARENCY_EVEN;
+
+	IdleScheduler::registerJob(Object::safeCast(this), (IdleJob)&SpriteManager::sortWhileIdle);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 void SpriteManager::disable()
 {
+	IdleScheduler::unregisterJob(Object::safeCast(this), NULL);
+
 	SpriteManager::stopListeningForVBlank(this);
 
 	Base::disable(this);
@@ -408,6 +431,19 @@ void SpriteManager::sortSprites()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+bool SpriteManager::sortWhileIdle()
+{
+	Hardware::suspendInterrupts();
+
+	bool swapped = SpriteManager::sortProgressively(this, false);
+
+	Hardware::resumeInterrupts();
+
+	return swapped;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void SpriteManager::render(bool deferred)
 {
 	if(!deferred)
@@ -504,8 +540,11 @@ void SpriteManager::commitGraphics()
 	_writtenObjectTiles = 0;
 #endif
 
-	// Update graphics memory
-	TextureManager::updateTextures(this->texturesMaximumRowsToWrite, this->deferTextureUpdating);
+	// Update graphics memory, the textures that matter the most go first
+	if(SpriteManager::uploadTextures(this) || !this->deferTextureUpdating)
+	{
+		TextureManager::updateTextures(this->texturesMaximumRowsToWrite, this->deferTextureUpdating);
+	}
 	SpriteManager::applySpecialEffects(this);
 
 	DisplayUnit::commitGraphics();
@@ -812,3 +851,36 @@ void SpriteManager::stopListeningForVBlank()
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+bool SpriteManager::uploadTextures()
+{
+	for(VirtualNode node = this->components->head; NULL != node; node = node->next)
+	{
+		Sprite sprite = Sprite::safeCast(node->data);
+
+		if(sprite->deleteMe || __HIDE == sprite->show || NULL == sprite->texture)
+		{
+			continue;
+		}
+
+		// Most textures are already written, so filter them out before anything else
+		if(kTextureWritten <= sprite->texture->status)
+		{
+			continue;
+		}
+
+		// Reuse the position projected during the last render instead of projecting again
+		bool visible = !sprite->projected || Sprite::isWithinScreenSpace(sprite);
+
+		TextureUploadQueue::push(sprite->texture, visible, (sprite->halfWidth * sprite->halfHeight) << 2);
+	}
+
+	if(!this->deferTextureUpdating)
+	{
+		return TextureUploadQueue::upload(-1, 0xFFFFFFFF);
+	}
+
+	return TextureUploadQueue::upload(this->texturesMaximumRowsToWrite, __TEXTURE_UPLOAD_BUDGET_US);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
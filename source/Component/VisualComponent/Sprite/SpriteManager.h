@@ -190,6 +190,10 @@ class SpriteManager : ComponentManager
 	/// Force the writing of graphical data to DRAM space.
 	void writeTextures();
 
+	/// Run a sorting pass in the game frame's slack.
+	/// @return True if the sprites are not sorted yet; false otherwise
+	bool sortWhileIdle();
+
 	/// Invalidate the rendering status of all sprites so they re-render again in the next cycle.
 	void invalidateRendering();
 
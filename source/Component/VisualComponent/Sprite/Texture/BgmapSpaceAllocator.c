@@ -0,0 +1,367 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+#ifdef __ENABLE_BGMAP_SPACE_ALLOCATOR
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <DebugConfig.h>
+#include <Printer.h>
+
+#include "BgmapSpaceAllocator.h"
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' ATTRIBUTES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static BgmapRegion _regions[__BGMAP_SPACE_ALLOCATOR_MAXIMUM_REGIONS];
+static int16 _buckets[__BGMAP_SPACE_ALLOCATOR_BUCKETS] = {[0 ... __BGMAP_SPACE_ALLOCATOR_BUCKETS - 1] = __BGMAP_NO_REGION};
+static uint8 _skyline[__MAX_NUMBER_OF_BGMAPS_SEGMENTS][__BGMAP_SEGMENT_COLS];
+static uint8 _availableRows[__MAX_NUMBER_OF_BGMAPS_SEGMENTS] = {[0 ... __MAX_NUMBER_OF_BGMAPS_SEGMENTS - 1] = __BGMAP_SEGMENT_ROWS};
+static uint16 _usedCells[__MAX_NUMBER_OF_BGMAPS_SEGMENTS];
+static uint16 _trappedCells[__MAX_NUMBER_OF_BGMAPS_SEGMENTS];
+static uint16 _sharedAllocations = 0;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PUBLIC STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void BgmapSpaceAllocator::reset()
+{
+	for(int16 i = 0; i < __BGMAP_SPACE_ALLOCATOR_MAXIMUM_REGIONS; i++)
+	{
+		_regions[i].textureSpec = NULL;
+		_regions[i].next = __BGMAP_NO_REGION;
+		_regions[i].usageCount = 0;
+	}
+
+	for(int16 i = 0; i < __BGMAP_SPACE_ALLOCATOR_BUCKETS; i++)
+	{
+		_buckets[i] = __BGMAP_NO_REGION;
+	}
+
+	for(int16 segment = 0; segment < __MAX_NUMBER_OF_BGMAPS_SEGMENTS; segment++)
+	{
+		BgmapSpaceAllocator::clearSegment(segment);
+		_availableRows[segment] = __BGMAP_SEGMENT_ROWS;
+	}
+
+	// The printing area takes the bottom rows of the last segment
+	BgmapSpaceAllocator::reserveRows
+	(
+		__MAX_NUMBER_OF_BGMAPS_SEGMENTS - 1, __BGMAP_SEGMENT_ROWS - (__PRINTING_BGMAP_Y_OFFSET >> 3)
+	);
+
+	_sharedAllocations = 0;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void BgmapSpaceAllocator::reserveRows(uint8 segment, uint8 rows)
+{
+	if(__MAX_NUMBER_OF_BGMAPS_SEGMENTS <= segment)
+	{
+		return;
+	}
+
+	_availableRows[segment] = __BGMAP_SEGMENT_ROWS > rows ? __BGMAP_SEGMENT_ROWS - rows : 0;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static int16 BgmapSpaceAllocator::allocate(const TextureSpec* textureSpec, uint8 palette, uint16 frame)
+{
+	if(NULL == textureSpec)
+	{
+		return __BGMAP_NO_REGION;
+	}
+
+	uint32 hash = BgmapSpaceAllocator::computeHash(textureSpec, palette, frame);
+	int16* bucket = &_buckets[hash & (__BGMAP_SPACE_ALLOCATOR_BUCKETS - 1)];
+
+	for(int16 i = *bucket; __BGMAP_NO_REGION != i; i = _regions[i].next)
+	{
+		BgmapRegion* region = &_regions[i];
+
+		if(hash == region->hash && textureSpec == region->textureSpec && palette == region->palette && frame == region->frame)
+		{
+			region->usageCount++;
+			_sharedAllocations++;
+
+			return i;
+		}
+	}
+
+	int16 index = 0;
+
+	for(; index < __BGMAP_SPACE_ALLOCATOR_MAXIMUM_REGIONS && 0 < _regions[index].usageCount; index++);
+
+	NM_ASSERT(__BGMAP_SPACE_ALLOCATOR_MAXIMUM_REGIONS > index, "BgmapSpaceAllocator::allocate: no free regions");
+
+	if(__BGMAP_SPACE_ALLOCATOR_MAXIMUM_REGIONS <= index)
+	{
+		return __BGMAP_NO_REGION;
+	}
+
+	BgmapRegion* region = &_regions[index];
+
+	region->cols = textureSpec->cols + (textureSpec->padding.cols << 1);
+	region->rows = textureSpec->rows + (textureSpec->padding.rows << 1);
+
+	if(!BgmapSpaceAllocator::pack(region))
+	{
+		return __BGMAP_NO_REGION;
+	}
+
+	region->textureSpec = textureSpec;
+	region->hash = hash;
+	region->palette = palette;
+	region->frame = frame;
+	region->usageCount = 1;
+	region->next = *bucket;
+
+	*bucket = index;
+
+	return index;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void BgmapSpaceAllocator::release(int16 index)
+{
+	if(0 > index || __BGMAP_SPACE_ALLOCATOR_MAXIMUM_REGIONS <= index || 0 >= _regions[index].usageCount)
+	{
+		return;
+	}
+
+	BgmapRegion* region = &_regions[index];
+
+	if(0 < --region->usageCount)
+	{
+		return;
+	}
+
+	// Unlink the region from its bucket
+	int16* link = &_buckets[region->hash & (__BGMAP_SPACE_ALLOCATOR_BUCKETS - 1)];
+
+	for(; __BGMAP_NO_REGION != *link && index != *link; link = &_regions[*link].next);
+
+	if(index == *link)
+	{
+		*link = region->next;
+	}
+
+	region->next = __BGMAP_NO_REGION;
+	region->textureSpec = NULL;
+
+	uint8 segment = region->segment;
+
+	_usedCells[segment] -= region->cols * region->rows;
+
+	if(0 == _usedCells[segment])
+	{
+		BgmapSpaceAllocator::clearSegment(segment);
+		return;
+	}
+
+	bool onTop = true;
+
+	for(int16 col = region->x; col < region->x + region->cols && onTop; col++)
+	{
+		onTop = region->y + region->rows == _skyline[segment][col];
+	}
+
+	if(onTop)
+	{
+		for(int16 col = region->x; col < region->x + region->cols; col++)
+		{
+			_skyline[segment][col] = region->y;
+		}
+	}
+	else
+	{
+		_trappedCells[segment] += region->cols * region->rows;
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static const BgmapRegion* BgmapSpaceAllocator::getRegion(int16 index)
+{
+	if(0 > index || __BGMAP_SPACE_ALLOCATOR_MAXIMUM_REGIONS <= index || 0 >= _regions[index].usageCount)
+	{
+		return NULL;
+	}
+
+	return &_regions[index];
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint32 BgmapSpaceAllocator::getOccupancy()
+{
+	uint32 usedCells = 0;
+	uint32 availableCells = 0;
+
+	for(int16 segment = 0; segment < __MAX_NUMBER_OF_BGMAPS_SEGMENTS; segment++)
+	{
+		usedCells += _usedCells[segment];
+		availableCells += _availableRows[segment] * __BGMAP_SEGMENT_COLS;
+	}
+
+	return 0 < availableCells ? (usedCells * 100) / availableCells : 0;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint32 BgmapSpaceAllocator::getFragmentation()
+{
+	uint32 trappedCells = 0;
+	uint32 cellsBelowSkyline = 0;
+
+	for(int16 segment = 0; segment < __MAX_NUMBER_OF_BGMAPS_SEGMENTS; segment++)
+	{
+		trappedCells += _trappedCells[segment];
+
+		for(int16 col = 0; col < __BGMAP_SEGMENT_COLS; col++)
+		{
+			cellsBelowSkyline += _skyline[segment][col];
+		}
+	}
+
+	return 0 < cellsBelowSkyline ? (trappedCells * 100) / cellsBelowSkyline : 0;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void BgmapSpaceAllocator::print(int32 x, int32 y)
+{
+	int16 regions = 0;
+
+	for(int16 i = 0; i < __BGMAP_SPACE_ALLOCATOR_MAXIMUM_REGIONS; i++)
+	{
+		regions += 0 < _regions[i].usageCount ? 1 : 0;
+	}
+
+	Printer::text("BGMAP SPACE", x, y++, NULL);
+	y++;
+
+	Printer::text("Regions:      ", x, y, NULL);
+	Printer::int32(regions, x + 14, y++, NULL);
+	Printer::text("Shared:       ", x, y, NULL);
+	Printer::int32(_sharedAllocations, x + 14, y++, NULL);
+	Printer::text("Occupancy:    ", x, y, NULL);
+	Printer::int32(BgmapSpaceAllocator::getOccupancy(), x + 14, y++, NULL);
+	Printer::text("Fragment.:    ", x, y, NULL);
+	Printer::int32(BgmapSpaceAllocator::getFragmentation(), x + 14, y++, NULL);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint32 BgmapSpaceAllocator::computeHash(const TextureSpec* textureSpec, uint8 palette, uint16 frame)
+{
+	// Multiplicative hashing spreads the specs' addresses, which are aligned, across the buckets
+	return ((uint32)textureSpec * 2654435761u) ^ (palette << 16) ^ frame;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static bool BgmapSpaceAllocator::pack(BgmapRegion* region)
+{
+	if(__BGMAP_SEGMENT_COLS < region->cols || 0 == region->cols || 0 == region->rows)
+	{
+		return false;
+	}
+
+	int16 bestSegment = -1;
+	uint8 bestX = 0;
+	uint8 bestY = 0;
+	uint8 bestTop = 0xFF;
+
+	for(int16 segment = 0; segment < __MAX_NUMBER_OF_BGMAPS_SEGMENTS; segment++)
+	{
+		if(_availableRows[segment] < region->rows)
+		{
+			continue;
+		}
+
+		for(int16 x = 0; x + region->cols <= __BGMAP_SEGMENT_COLS; x++)
+		{
+			uint8 y = 0;
+
+			for(int16 col = x; col < x + region->cols; col++)
+			{
+				y = y < _skyline[segment][col] ? _skyline[segment][col] : y;
+			}
+
+			if(_availableRows[segment] < y + region->rows || bestTop <= y + region->rows)
+			{
+				continue;
+			}
+
+			bestSegment = segment;
+			bestX = x;
+			bestY = y;
+			bestTop = y + region->rows;
+		}
+
+		// Nothing beats a region that sits at the bottom of a segment
+		if(bestTop == region->rows)
+		{
+			break;
+		}
+	}
+
+	if(0 > bestSegment)
+	{
+		return false;
+	}
+
+	for(int16 col = bestX; col < bestX + region->cols; col++)
+	{
+		// The cells between the skyline and the region become unusable
+		_trappedCells[bestSegment] += bestY - _skyline[bestSegment][col];
+		_skyline[bestSegment][col] = bestTop;
+	}
+
+	_usedCells[bestSegment] += region->cols * region->rows;
+
+	region->segment = bestSegment;
+	region->x = bestX;
+	region->y = bestY;
+
+	return true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void BgmapSpaceAllocator::clearSegment(uint8 segment)
+{
+	for(int16 col = 0; col < __BGMAP_SEGMENT_COLS; col++)
+	{
+		_skyline[segment][col] = 0;
+	}
+
+	_usedCells[segment] = 0;
+	_trappedCells[segment] = 0;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#endif
@@ -0,0 +1,150 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+#ifndef BGMAP_SPACE_ALLOCATOR_H_
+#define BGMAP_SPACE_ALLOCATOR_H_
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <Object.h>
+#include <Texture.h>
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+// Printing the allocator's statistics requires it
+#ifdef __DEBUGGING_BGMAP_SPACE_ALLOCATOR
+#undef __ENABLE_BGMAP_SPACE_ALLOCATOR
+#define __ENABLE_BGMAP_SPACE_ALLOCATOR
+#endif
+
+#ifndef __BGMAP_SPACE_ALLOCATOR_MAXIMUM_REGIONS
+#define __BGMAP_SPACE_ALLOCATOR_MAXIMUM_REGIONS		64
+#endif
+
+#ifndef __BGMAP_SPACE_ALLOCATOR_BUCKETS
+#define __BGMAP_SPACE_ALLOCATOR_BUCKETS				32
+#endif
+
+/// Number of columns and rows of each BGMap segment
+#define __BGMAP_SEGMENT_COLS						64
+#define __BGMAP_SEGMENT_ROWS						64
+
+/// Handle returned when no region could be allocated
+#define __BGMAP_NO_REGION							-1
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DATA
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// A rectangle of BGMap space shared by the textures that display the same contents
+/// @memberof BgmapSpaceAllocator
+typedef struct BgmapRegion
+{
+	/// Spec of the texture whose contents the region holds
+	const TextureSpec* textureSpec;
+
+	/// Hash of the spec, palette and frame
+	uint32 hash;
+
+	/// Next region in the same hash bucket
+	int16 next;
+
+	/// Number of textures that use the region
+	int16 usageCount;
+
+	/// Frame of the texture whose contents the region holds
+	uint16 frame;
+
+	/// Palette of the texture whose contents the region holds
+	uint8 palette;
+
+	/// BGMap segment
+	uint8 segment;
+
+	/// Column inside the segment
+	uint8 x;
+
+	/// Row inside the segment
+	uint8 y;
+
+	/// Width in chars
+	uint8 cols;
+
+	/// Height in chars
+	uint8 rows;
+
+} BgmapRegion;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DECLARATION
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Class BgmapSpaceAllocator
+///
+/// Inherits from Object
+///
+/// Allocates rectangles of BGMap space for textures. Textures with the same spec, palette and frame share 
+/// the same region, which is released when the last of them lets it go. The regions are packed into the
+/// segments with a skyline packer: each segment keeps the height filled in each of its columns, and new
+/// regions are placed where the resulting height is the lowest. Released regions that lie on top of the
+/// skyline lower it back; the others are trapped until their segment gets empty.
+///
+/// The allocator is standalone: it only does the bookkeeping of the BGMap space. It is reset together
+/// with the rest of the graphics memory managers when the SpriteManager is enabled, and it always keeps
+/// the printing area (the bottom rows of the last segment) out of reach. BGMap texture managers call
+/// allocate when a texture needs space and release when they let it go, and write the texture at
+/// segment's base + (y * __BGMAP_SEGMENT_COLS + x) BGMap entries of the region that they got back.
+/// Only available if __ENABLE_BGMAP_SPACE_ALLOCATOR is defined.
+static class BgmapSpaceAllocator : Object
+{
+	/// @publicsection
+
+	/// Release all the regions and reservations.
+	static void reset();
+
+	/// Reserve rows at the bottom of a segment for other uses, like the printing area.
+	/// @param segment: BGMap segment
+	/// @param rows: Number of rows to reserve at the bottom of the segment
+	static void reserveRows(uint8 segment, uint8 rows);
+
+	/// Allocate a region for a texture or retrieve the one that already holds the same contents.
+	/// @param textureSpec: Spec of the texture
+	/// @param palette: Palette of the texture
+	/// @param frame: Frame of the texture
+	/// @return Handle of the region; __BGMAP_NO_REGION if there is no space left
+	static int16 allocate(const TextureSpec* textureSpec, uint8 palette, uint16 frame);
+
+	/// Release a region.
+	/// @param region: Handle of the region returned by allocate
+	static void release(int16 region);
+
+	/// Retrieve a region.
+	/// @param region: Handle of the region returned by allocate
+	/// @return Pointer to the region; NULL if the handle is not valid
+	static const BgmapRegion* getRegion(int16 region);
+
+	/// Retrieve the percentage of the BGMap space that is used by the regions.
+	/// @return Occupancy percentage
+	static uint32 getOccupancy();
+
+	/// Retrieve the percentage of the space below the segments' skylines that cannot be used.
+	/// @return Fragmentation percentage
+	static uint32 getFragmentation();
+
+	/// Print the allocator's statistics.
+	/// @param x: Screen x coordinate where to print
+	/// @param y: Screen y coordinate where to print
+	static void print(int32 x, int32 y);
+}
+
+#endif
@@ -0,0 +1,328 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <DebugConfig.h>
+#include <Math.h>
+#include <Printer.h>
+#include <StopwatchManager.h>
+#include <Texture.h>
+#include <Timer.h>
+
+#include "TextureUploadQueue.h"
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DECLARATIONS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+friend class Texture;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Estimate of the bytes written per texture char: its 16 bytes of pixel data plus its 2 bytes BGMap entry
+#define __TEXTURE_UPLOAD_BYTES_PER_CHAR			18
+
+#define __TEXTURE_UPLOAD_PRIORITY_VISIBLE		0x80000000
+#define __TEXTURE_UPLOAD_PRIORITY_FRAME_DUE		0x40000000
+#define __TEXTURE_UPLOAD_PRIORITY_AREA_MASK		0x3FFFFFFF
+
+/// Budget that disables the time limit
+#define __TEXTURE_UPLOAD_UNLIMITED_BUDGET		0xFFFFFFFF
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' ATTRIBUTES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static TextureUploadRequest _requests[__TEXTURE_UPLOAD_QUEUE_SIZE];
+static uint8 _queuedRequests = 0;
+static uint32 _uploadedBytes = 0;
+static uint32 _deferredBytes = 0;
+static uint32 _droppedBytes = 0;
+static uint32 _usedBudgetUS = 0;
+static uint32 _frameStartInterrupts = 0;
+static uint16 _frameStartTimerCounter = 0;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PUBLIC STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void TextureUploadQueue::push(Texture texture, bool visible, uint32 area)
+{
+	if(isDeleted(texture) || kTextureWritten <= texture->status)
+	{
+		return;
+	}
+
+	// Textures on screen go first, then the animation frames that are due, the bigger the sooner
+	uint32 priority = Math::min(area, __TEXTURE_UPLOAD_PRIORITY_AREA_MASK);
+
+	if(visible)
+	{
+		priority |= __TEXTURE_UPLOAD_PRIORITY_VISIBLE;
+	}
+
+	if(kTextureFrameChanged == texture->status)
+	{
+		priority |= __TEXTURE_UPLOAD_PRIORITY_FRAME_DUE;
+	}
+
+	int16 index = 0;
+
+	// Shared textures are queued once with the highest priority among their sprites
+	for(; index < _queuedRequests && texture != _requests[index].texture; index++);
+
+	if(index < _queuedRequests)
+	{
+		if(priority <= _requests[index].priority)
+		{
+			return;
+		}
+
+		TextureUploadQueue::remove(index);
+	}
+
+	uint32 bytes = Texture::getCols(texture) * Texture::getRows(texture) * __TEXTURE_UPLOAD_BYTES_PER_CHAR;
+
+	if(__TEXTURE_UPLOAD_QUEUE_SIZE <= _queuedRequests)
+	{
+		if(priority <= _requests[_queuedRequests - 1].priority)
+		{
+			_droppedBytes += bytes;
+			return;
+		}
+
+		_droppedBytes += _requests[_queuedRequests - 1].bytes;
+		_queuedRequests--;
+	}
+
+	for(index = _queuedRequests; 0 < index && priority > _requests[index - 1].priority; index--)
+	{
+		_requests[index] = _requests[index - 1];
+	}
+
+	_requests[index].texture = texture;
+	_requests[index].priority = priority;
+	_requests[index].bytes = bytes;
+
+	_queuedRequests++;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void TextureUploadQueue::frameStarted()
+{
+	_frameStartInterrupts = StopwatchManager::getInterrupts(StopwatchManager::getInstance());
+	_frameStartTimerCounter = Timer::getCurrentTimerCounter();
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static bool TextureUploadQueue::upload(int16 maximumTextureRowsToWrite, uint32 budgetUS)
+{
+	_uploadedBytes = 0;
+	_deferredBytes = _droppedBytes;
+	_droppedBytes = 0;
+	_usedBudgetUS = 0;
+
+	if(__TEXTURE_UPLOAD_UNLIMITED_BUDGET == budgetUS)
+	{
+		for(int16 index = 0; index < _queuedRequests; index++)
+		{
+			Texture::update(_requests[index].texture, maximumTextureRowsToWrite);
+			_uploadedBytes += _requests[index].bytes;
+		}
+
+		_queuedRequests = 0;
+
+		return 0 == _deferredBytes;
+	}
+
+	uint16 previousTimerCounter = _frameStartTimerCounter;
+	uint32 previousInterrupts = _frameStartInterrupts;
+
+	// Graphics memory can only be written until the next frame starts, so the budget is capped to
+	// what is left of the current one
+	uint32 frameTicks = (__MICROSECONDS_PER_SECOND / __MAXIMUM_FPS) / Timer::getResolutionInUS();
+	uint32 frameElapsedTicks = TextureUploadQueue::computeElapsedTicks(&previousTimerCounter, &previousInterrupts);
+	uint32 budgetTicks = budgetUS / Timer::getResolutionInUS();
+
+	if(frameElapsedTicks >= frameTicks)
+	{
+		budgetTicks = 0;
+	}
+	else if(frameTicks - frameElapsedTicks < budgetTicks)
+	{
+		budgetTicks = frameTicks - frameElapsedTicks;
+	}
+
+	// A single write is never allowed to span more than a timer period, so no reload goes unnoticed
+	// even if the timer's interrupt cannot be serviced during the upload
+	uint32 timerPeriodTicks = Timer::getTimerCounter();
+	uint32 elapsedTicks = 0;
+	uint32 writtenRows = 0;
+	bool exhausted = 0 == budgetTicks;
+	int16 index = 0;
+
+	for(; index < _queuedRequests && !exhausted; index++)
+	{
+		Texture texture = _requests[index].texture;
+		uint32 textureRows = Texture::getRows(texture);
+		uint32 rowsLeft = textureRows;
+
+		if(0 <= maximumTextureRowsToWrite && (uint32)maximumTextureRowsToWrite < rowsLeft)
+		{
+			rowsLeft = maximumTextureRowsToWrite;
+		}
+
+		uint32 textureWrittenRows = 0;
+		uint8 status = texture->status;
+
+		while(0 < rowsLeft && kTextureWritten > status)
+		{
+			// Until a row has been timed, a single one is written to measure the cost per row
+			uint32 rowsToWrite = 1;
+
+			if(0 < writtenRows)
+			{
+				uint32 ticksPerRow = elapsedTicks / writtenRows;
+				uint32 affordableTicks = budgetTicks - elapsedTicks;
+
+				if(timerPeriodTicks < affordableTicks)
+				{
+					affordableTicks = timerPeriodTicks;
+				}
+
+				rowsToWrite = Math::min(rowsLeft, affordableTicks / (0 == ticksPerRow ? 1 : ticksPerRow));
+			}
+
+			if(0 == rowsToWrite)
+			{
+				exhausted = true;
+				break;
+			}
+
+			status = Texture::update(texture, (int16)rowsToWrite);
+
+			rowsLeft -= rowsToWrite;
+			textureWrittenRows += rowsToWrite;
+			writtenRows += rowsToWrite;
+			elapsedTicks += TextureUploadQueue::computeElapsedTicks(&previousTimerCounter, &previousInterrupts);
+
+			if(elapsedTicks >= budgetTicks)
+			{
+				exhausted = true;
+				break;
+			}
+		}
+
+		if(kTextureWritten <= status)
+		{
+			_uploadedBytes += _requests[index].bytes;
+		}
+		else
+		{
+			// Only the rows that made it to graphics memory count as uploaded
+			uint32 uploadedBytes = _requests[index].bytes * Math::min(textureWrittenRows, textureRows) / textureRows;
+
+			_uploadedBytes += uploadedBytes;
+			_deferredBytes += _requests[index].bytes - uploadedBytes;
+		}
+	}
+
+	bool completed = index == _queuedRequests;
+
+	for(; index < _queuedRequests; index++)
+	{
+		_deferredBytes += _requests[index].bytes;
+	}
+
+	_usedBudgetUS = elapsedTicks * Timer::getResolutionInUS();
+	_queuedRequests = 0;
+
+	return completed && 0 == _deferredBytes;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint32 TextureUploadQueue::getUploadedBytes()
+{
+	return _uploadedBytes;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint32 TextureUploadQueue::getDeferredBytes()
+{
+	return _deferredBytes;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void TextureUploadQueue::print(int32 x, int32 y)
+{
+	Printer::text("TEXTURE UPLOADS", x, y++, NULL);
+	y++;
+
+	Printer::text("Uploaded:     ", x, y, NULL);
+	Printer::int32(_uploadedBytes, x + 12, y++, NULL);
+	Printer::text("Deferred:     ", x, y, NULL);
+	Printer::int32(_deferredBytes, x + 12, y++, NULL);
+	Printer::text("Used (us):    ", x, y, NULL);
+	Printer::int32(_usedBudgetUS, x + 12, y++, NULL);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void TextureUploadQueue::remove(int16 index)
+{
+	_queuedRequests--;
+
+	for(int16 i = index; i < _queuedRequests; i++)
+	{
+		_requests[i] = _requests[i + 1];
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint32 TextureUploadQueue::computeElapsedTicks(uint16* previousTimerCounter, uint32* previousInterrupts)
+{
+	uint16 currentTimerCounter = Timer::getCurrentTimerCounter();
+	uint32 currentInterrupts = StopwatchManager::getInterrupts(StopwatchManager::getInstance());
+	uint32 reloads = currentInterrupts - *previousInterrupts;
+
+	// The timer counts down and reloads upon reaching zero; a reload whose interrupt has not been
+	// serviced yet only shows as a counter higher than the previous one
+	if(0 == reloads && currentTimerCounter > *previousTimerCounter)
+	{
+		reloads = 1;
+	}
+
+	uint32 elapsedTicks = reloads * Timer::getTimerCounter() + *previousTimerCounter - currentTimerCounter;
+
+	*previousTimerCounter = currentTimerCounter;
+	*previousInterrupts = currentInterrupts;
+
+	return elapsedTicks;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
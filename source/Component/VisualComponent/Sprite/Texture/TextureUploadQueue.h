@@ -0,0 +1,103 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+#ifndef TEXTURE_UPLOAD_QUEUE_H_
+#define TEXTURE_UPLOAD_QUEUE_H_
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <Object.h>
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// FORWARD DECLARATIONS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+class Texture;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#ifndef __TEXTURE_UPLOAD_QUEUE_SIZE
+#define __TEXTURE_UPLOAD_QUEUE_SIZE				16
+#endif
+
+/// Upper bound of the time spent writing textures per frame; the actual budget is whatever
+/// is left of the frame if that is less
+#ifndef __TEXTURE_UPLOAD_BUDGET_US
+#define __TEXTURE_UPLOAD_BUDGET_US				2000
+#endif
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DATA
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Request to upload a texture
+/// @memberof TextureUploadQueue
+typedef struct TextureUploadRequest
+{
+	/// Texture to upload
+	Texture texture;
+
+	/// Priority of the upload, higher values are uploaded first
+	uint32 priority;
+
+	/// Estimated number of bytes to write
+	uint32 bytes;
+
+} TextureUploadRequest;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DECLARATION
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Class TextureUploadQueue
+///
+/// Inherits from Object
+///
+/// Orders the pending texture writes so the ones that show on screen go first, followed by the animation
+/// frames that are due and the bigger textures, and writes them until a time budget runs out.
+/// The writes are timed in steps shorter than the timer's period so no timer reload goes unnoticed.
+static class TextureUploadQueue : Object
+{
+	/// @publicsection
+
+	/// Queue a texture for upload if it has pending writes.
+	/// @param texture: Texture to upload
+	/// @param visible: True if the texture is displayed on screen
+	/// @param area: Screen area covered by the texture
+	static void push(Texture texture, bool visible, uint32 area);
+
+	/// Record the start of a frame, against which the time left to write textures is computed.
+	static void frameStarted();
+
+	/// Write the queued textures in order of priority until the time budget or the frame runs out;
+	/// the rows written so far set the cost per row that limits how many rows each write gets.
+	/// @param maximumTextureRowsToWrite: Number of texture rows to write per texture; -1 for no limit
+	/// @param budgetUS: Time budget in microseconds; 0xFFFFFFFF to write everything regardless of time
+	/// @return True if all the queued textures were written
+	static bool upload(int16 maximumTextureRowsToWrite, uint32 budgetUS);
+
+	/// Retrieve the estimated number of bytes written during the last upload.
+	/// @return Estimated number of bytes written
+	static uint32 getUploadedBytes();
+
+	/// Retrieve the estimated number of bytes deferred during the last upload.
+	/// @return Estimated number of bytes deferred
+	static uint32 getDeferredBytes();
+
+	/// Print the queue's statistics.
+	/// @param x: Screen x coordinate where to print
+	/// @param y: Screen y coordinate where to print
+	static void print(int32 x, int32 y);
+}
+
+#endif
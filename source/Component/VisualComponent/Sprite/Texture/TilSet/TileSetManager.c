@@ -11,6 +11,8 @@
 // INCLUDES
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+#include <Hardware.h>
+#include <IdleScheduler.h>
 #include <TileSet.h>
 #include <Mem.h>
 #include <Printer.h>
@@ -153,7 +155,7 @@ secure bool TileSetManager::releaseTileSet(TileSet tileSet)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-secure void TileSetManager::defragment(bool deferred)
+secure bool TileSetManager::defragment(bool deferred)
 {
 	if(1 < this->freedOffset)
 	{
@@ -188,6 +190,45 @@ secure void TileSetManager::defragment(bool deferred)
 		}
 		while(!deferred && 1 < this->freedOffset);
 	}
+
+	return 1 < this->freedOffset;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+bool TileSetManager::defragmentWhileIdle()
+{
+	if(1 >= this->freedOffset)
+	{
+		return false;
+	}
+
+	Hardware::suspendInterrupts();
+
+	bool pending = TileSetManager::defragment(this, true);
+
+	Hardware::resumeInterrupts();
+
+	return pending;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void TileSetManager::setReclaimer(Object reclaimerOwner, TileSetReclaimer reclaimer)
+{
+	this->reclaimerOwner = reclaimerOwner;
+	this->reclaimer = NULL != reclaimerOwner ? reclaimer : NULL;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void TileSetManager::removeReclaimer(Object reclaimerOwner)
+{
+	if(reclaimerOwner == this->reclaimerOwner)
+	{
+		this->reclaimerOwner = NULL;
+		this->reclaimer = NULL;
+	}
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -229,12 +270,18 @@ void TileSetManager::constructor()
 
 	this->tileSets = new VirtualList();
 	this->freedOffset = 1;
+	this->reclaimerOwner = NULL;
+	this->reclaimer = NULL;
+
+	IdleScheduler::registerJob(Object::safeCast(this), (IdleJob)&TileSetManager::defragmentWhileIdle);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 void TileSetManager::destructor()
 {
+	IdleScheduler::unregisterJob(Object::safeCast(this), NULL);
+
 	TileSetManager::reset(this);
 
 	delete this->tileSets;
@@ -287,6 +334,15 @@ TileSet TileSetManager::allocateTileSet(const TileSetSpec* tileSetSpec)
 		return tileSet;
 	}
 
+	// Make room by releasing the tile sets that are kept resident but not in use, and try again;
+	// the reclaimer returns false once it has nothing left to release
+	if(NULL != this->reclaimer && !isDeleted(this->reclaimerOwner) && this->reclaimer(this->reclaimerOwner))
+	{
+		TileSetManager::defragment(this, false);
+
+		return TileSetManager::allocateTileSet(this, tileSetSpec);
+	}
+
 #ifdef __ALERT_TILE_MEMORY_DEPLETION
 	Printer::setDebugMode();
 	Printer::clear();
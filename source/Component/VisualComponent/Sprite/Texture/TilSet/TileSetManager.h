@@ -23,6 +23,14 @@
 
 class VirtualList;
 
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DATA
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Callback to release tile sets that are kept resident but are not in use
+/// @memberof TileSetManager
+typedef bool (*TileSetReclaimer)(Object owner);
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DECLARATION
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -42,6 +50,12 @@ singleton class TileSetManager : Object
 	/// Start offset in TILE space when free memory starts
 	uint16 freedOffset;
 
+	/// Object that keeps tile sets resident without using them
+	Object reclaimerOwner;
+
+	/// Callback to make the reclaimer's owner release the tile sets that it keeps resident
+	TileSetReclaimer reclaimer;
+
 	/// @publicsection
 	
 	/// Print the manager's status.
@@ -73,8 +87,23 @@ singleton class TileSetManager : Object
 	void writeTileSets();
 
 	/// Defragment TILE space.
-	/// @return True if memory was defragmented; false otherwise
-	void defragment(bool deferred);
+	/// @param deferred: If true, only a single TileSet is moved
+	/// @return True if there is still TILE space to defragment; false otherwise
+	bool defragment(bool deferred);
+
+	/// Run a step of the defragmentation of TILE space in the game frame's slack.
+	/// @return True if there is still TILE space to defragment; false otherwise
+	bool defragmentWhileIdle();
+
+	/// Register the callback to call when TILE space is depleted to release tile sets that are
+	/// kept resident but are not in use.
+	/// @param reclaimerOwner: Object that keeps the tile sets resident
+	/// @param reclaimer: Callback that releases the tile sets; returns true if any was released
+	void setReclaimer(Object reclaimerOwner, TileSetReclaimer reclaimer);
+
+	/// Unregister the reclaimer if it belongs to the provided object.
+	/// @param reclaimerOwner: Object that registered the reclaimer
+	void removeReclaimer(Object reclaimerOwner);
 
 	/// Return the total number of used TILEs in TILE space.
 	/// @return Total number of used TILEs in TILE space
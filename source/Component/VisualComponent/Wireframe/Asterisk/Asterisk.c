@@ -42,6 +42,13 @@ void Asterisk::destructor()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+RightBox Asterisk::getRightBox()
+{
+	return (RightBox){-this->length, -this->length, -this->length, this->length, this->length, this->length};
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void Asterisk::render(Vector3D relativePosition)
 {
 	NM_ASSERT(NULL != this->transformation, "Asterisk::render: NULL transformation");
@@ -65,6 +65,10 @@ class Asterisk : Wireframe
 	/// @param asteriskSpec: Specification that determines how to configure the wireframe
 	void constructor(Entity owner, const AsteriskSpec* asteriskSpec);
 
+	/// Retrieve the wireframe's bounding box.
+	/// @return Bounding box of the wireframe
+	override RightBox getRightBox();
+
 	/// Prepare the wireframe for drawing.
 	/// @param relativePosition: Position relative to the camera's
 	override void render(Vector3D relativePosition);
@@ -12,6 +12,7 @@
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 #include <FrameBuffers.h>
+#include <Math.h>
 #include <WireframeManager.h>
 
 #include "Line.h"
@@ -41,6 +42,25 @@ void Line::destructor()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+RightBox Line::getRightBox()
+{
+	if(NULL == this->componentSpec)
+	{
+		return Base::getRightBox(this);
+	}
+
+	Vector3D a = ((LineSpec*)this->componentSpec)->a;
+	Vector3D b = ((LineSpec*)this->componentSpec)->b;
+
+	return (RightBox)
+	{
+		Math::min(a.x, b.x), Math::min(a.y, b.y), Math::min(a.z, b.z), 
+		Math::max(a.x, b.x), Math::max(a.y, b.y), Math::max(a.z, b.z)
+	};
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void Line::render(Vector3D relativePosition)
 {
 	if(NULL == this->componentSpec)
@@ -161,6 +161,7 @@ void Mesh::constructor(Entity owner, const MeshSpec* meshSpec)
 
 	this->segments = new VirtualList();
 	this->vertices = new VirtualList();
+	this->drawCycle = 0;
 
 	if(NULL != this->componentSpec)
 	{
@@ -322,8 +323,20 @@ bool Mesh::draw()
 
 	bool drawn = false;
 
+	// At lower levels of detail, only every (levelOfDetail + 1)th segment is drawn, alternating which ones
+	// on each game frame
+	uint16 stride = this->levelOfDetail + 1;
+	uint16 segment = stride - (this->drawCycle % stride);
+
 	for(VirtualNode node = this->segments->head; NULL != node; node = node->next)
 	{
+		if(0 != --segment)
+		{
+			continue;
+		}
+
+		segment = stride;
+
 		MeshSegment* meshSegment = (MeshSegment*)node->data;
 
 		// Draw the line in both buffers
@@ -335,6 +348,8 @@ bool Mesh::draw()
 			);
 	}
 
+	this->drawCycle++;
+
 	this->bufferIndex = !this->bufferIndex;
 
 	return drawn;
@@ -419,6 +434,8 @@ void Mesh::addSegment(Vector3D startVector, Vector3D endVector)
 	}
 
 	VirtualList::pushBack(this->segments, newMeshSegment);
+
+	Mesh::invalidateBoundingRadius(this);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
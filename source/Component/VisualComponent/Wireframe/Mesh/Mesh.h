@@ -79,6 +79,9 @@ class Mesh : Wireframe
 	/// List of vertices
 	VirtualList vertices;
 
+	/// Number of times that the mesh has been drawn, used to alternate the segments drawn at lower levels of detail
+	uint8 drawCycle;
+
 	/// Retrieve the bounding box defined by the provided mesh spec's values.
 	/// @return Bounding box of the resulting mesh
 	static RightBox getRightBoxFromSpec(MeshSpec* meshSpec);
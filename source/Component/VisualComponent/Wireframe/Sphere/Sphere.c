@@ -55,6 +55,13 @@ void Sphere::destructor()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+RightBox Sphere::getRightBox()
+{
+	return (RightBox){-this->radius, -this->radius, -this->radius, this->radius, this->radius, this->radius};
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void Sphere::render(Vector3D relativePosition)
 {
 	NM_ASSERT(NULL != this->transformation, "Sphere::render: NULL transformation");
@@ -92,6 +99,8 @@ bool Sphere::draw()
 void Sphere::setRadius(fixed_t radius)
 {
 	this->radius = __ABS(radius);
+
+	Sphere::invalidateBoundingRadius(this);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
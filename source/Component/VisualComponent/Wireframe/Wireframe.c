@@ -13,6 +13,7 @@
 
 #include <Camera.h>
 #include <DebugConfig.h>
+#include <Math.h>
 #include <VirtualList.h>
 #include <VirtualNode.h>
 
@@ -51,6 +52,8 @@ void Wireframe::constructor(Entity owner, const WireframeSpec* wireframeSpec)
 	}
 
 	this->bufferIndex = 0;
+	this->levelOfDetail = 0;
+	this->boundingRadius = -1;
 	this->squaredDistanceToCamera = 0;
 	this->rendered = false;
 	this->drawn = false;
@@ -75,6 +78,50 @@ void Wireframe::setDisplacement(Vector3D displacement)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+fixed_t Wireframe::getBoundingRadius()
+{
+	if(0 > this->boundingRadius)
+	{
+		RightBox rightBox = Wireframe::getRightBox(this);
+
+		// The sum of the largest extents along each axis never underestimates the euclidean radius 
+		this->boundingRadius = 
+			Math::max(__ABS(rightBox.x0), __ABS(rightBox.x1)) + Math::max(__ABS(rightBox.y0), __ABS(rightBox.y1)) + 
+			Math::max(__ABS(rightBox.z0), __ABS(rightBox.z1));
+	}
+
+	if(NULL == this->transformation)
+	{
+		return this->boundingRadius;
+	}
+
+	fix7_9 scale = 
+		Math::max(Math::max(this->transformation->scale.x, this->transformation->scale.y), this->transformation->scale.z);
+
+	if(__1I_FIX7_9 < scale)
+	{
+		return __FIXED_MULT(this->boundingRadius, __FIX7_9_TO_FIXED(scale));
+	}
+
+	return this->boundingRadius;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Wireframe::invalidateBoundingRadius()
+{
+	this->boundingRadius = -1;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Wireframe::setLevelOfDetail(uint8 levelOfDetail)
+{
+	this->levelOfDetail = levelOfDetail;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 bool Wireframe::isVisible()
 {
 	return this->drawn && __SHOW == this->show;
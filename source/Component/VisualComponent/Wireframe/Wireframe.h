@@ -75,6 +75,9 @@ abstract class Wireframe : VisualComponent
 	/// Wireframe's squared distance to the camera's position
 	fixed_ext_t squaredDistanceToCamera;
 
+	/// Radius of the sphere that bounds the wireframe around its position (negative if not computed yet)
+	fixed_t boundingRadius;
+
 	/// Flag that indicates that the wireframe has been drawn
 	bool drawn;
 
@@ -87,6 +90,9 @@ abstract class Wireframe : VisualComponent
 	/// Index of the last frame buffer used in interlaced mode 
 	uint8 bufferIndex;
 
+	/// Level of detail set by the manager according to the distance to the camera (0 is full detail)
+	uint8 levelOfDetail;
+
 	/// @publicsection
 	/// Class' constructor
 	/// @param owner: Entity to which the wireframe attaches to
@@ -97,6 +103,17 @@ abstract class Wireframe : VisualComponent
 	/// @param displacement: Displacement relative to the owner's spatial position
 	void setDisplacement(Vector3D displacement);
 
+	/// Retrieve the radius of the sphere that bounds the wireframe around its position.
+	/// @return Bounding radius
+	fixed_t getBoundingRadius();
+
+	/// Force the bounding radius to be computed again, must be called when the wireframe's geometry changes.
+	void invalidateBoundingRadius();
+
+	/// Set the level of detail with which to draw the wireframe.
+	/// @param levelOfDetail: Level of detail (0 is full detail)
+	void setLevelOfDetail(uint8 levelOfDetail);
+
 	/// Check if the wireframe is visible.
 	/// @return True if the wireframe is visible; false otherwise
 	bool isVisible();
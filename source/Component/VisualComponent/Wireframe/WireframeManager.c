@@ -15,7 +15,9 @@
 #include <Entity.h>
 #include <DebugConfig.h>
 #include <Printer.h>
+#include <Profiler.h>
 #include <VirtualList.h>
+#include <VUEngine.h>
 #include <DisplayUnit.h>
 #include <Wireframe.h>
 
@@ -43,6 +45,7 @@ void WireframeManager::constructor()
 	this->evenFrame = __TRANSPARENCY_EVEN;
 	this->renderedWireframes = 0;
 	this->drawnWireframes = 0;
+	this->culledWireframes = 0;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -63,15 +66,31 @@ bool WireframeManager::onEvent(ListenerObject eventFirer, uint16 eventCode)
 	{
 		case kEventDisplayUnitVBlank:
 		{
+#ifdef __ENABLE_PROFILER
+			Profiler::lap(kProfilerLapTypeStartInterrupt, NULL);
+#endif
+
 			WireframeManager::draw(this);
 
+#ifdef __ENABLE_PROFILER
+			Profiler::lap(kProfilerLapTypeVIPInterruptXPENDProcess, PROCESS_NAME_VRAM_WRITE);
+#endif
+
 			return true;
 		}
 
 		case kEventDisplayUnitVBlankDuringGameStart:
 		{
+#ifdef __ENABLE_PROFILER
+			Profiler::lap(kProfilerLapTypeStartInterrupt, NULL);
+#endif
+
 			WireframeManager::draw(this);
 
+#ifdef __ENABLE_PROFILER
+			Profiler::lap(kProfilerLapTypeVIPInterruptXPENDProcess, PROCESS_NAME_VRAM_WRITE);
+#endif
+
 			return true;
 		}
 	}
@@ -130,8 +149,9 @@ void WireframeManager::render(bool deferred __attribute__((unused)))
 		return;
 	}
 
-#ifdef __PROFILE_WIREFRAMES
+#ifndef __SHIPPING
 	this->renderedWireframes = 0;
+	this->culledWireframes = 0;
 #endif
 
 	Vector3D cameraDirection = Vector3D::rotate((Vector3D){0, 0, __1I_FIXED}, *_cameraRotation);
@@ -173,10 +193,25 @@ void WireframeManager::render(bool deferred __attribute__((unused)))
 		{
 			continue;
 		}
+
+		// Reject the wireframe before projecting any of its vertices
+		if(WireframeManager::cull(this, wireframe, relativePosition))
+		{
+			wireframe->color = __COLOR_BLACK;
+
+#ifdef __WIREFRAME_MANAGER_SORT_FOR_DRAWING
+			wireframe->squaredDistanceToCamera = __WIREFRAME_MAXIMUM_SQUARE_DISTANCE_TO_CAMERA;
+#endif
+
+#ifndef __SHIPPING
+			this->culledWireframes++;
+#endif
+			continue;
+		}
 	
 		Wireframe::render(wireframe, relativePosition);
 
-#ifdef __PROFILE_WIREFRAMES
+#ifndef __SHIPPING
 		this->renderedWireframes++;
 #endif
 	}
@@ -206,7 +241,7 @@ void WireframeManager::draw()
 		return;
 	}
 
-#ifdef __PROFILE_WIREFRAMES
+#ifndef __SHIPPING
 	this->drawnWireframes = 0;
 #endif
 
@@ -237,7 +272,7 @@ void WireframeManager::draw()
 			Entity::setVisible(wireframe->owner);
 		}
 
-#ifdef __PROFILE_WIREFRAMES
+#ifndef __SHIPPING
 		this->drawnWireframes++;
 #endif
 	}
@@ -295,6 +330,8 @@ void WireframeManager::print(int32 x, int32 y)
 	Printer::int32(this->renderedWireframes, x + 12, y++, NULL);
 	Printer::text("Drawn:        ", x, y, NULL);
 	Printer::int32(this->drawnWireframes, x + 12, y++, NULL);
+	Printer::text("Culled:       ", x, y, NULL);
+	Printer::int32(this->culledWireframes, x + 12, y++, NULL);
 }
 #endif
 
@@ -330,6 +367,54 @@ void WireframeManager::stopListeningForVBlank()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+bool WireframeManager::cull(Wireframe wireframe, Vector3D relativePosition)
+{
+#if 0 < __WIREFRAME_MANAGER_DRAW_DISTANCE || 0 < __WIREFRAME_MANAGER_LEVEL_OF_DETAIL_DISTANCE
+	fixed_ext_t squaredDistanceToCamera = Vector3D::squareLength(relativePosition);
+#endif
+
+#if 0 < __WIREFRAME_MANAGER_DRAW_DISTANCE
+	if(__FIXED_SQUARE(__PIXELS_TO_METERS(__WIREFRAME_MANAGER_DRAW_DISTANCE)) < squaredDistanceToCamera)
+	{
+		return true;
+	}
+#endif
+
+	fixed_t radius = Wireframe::getBoundingRadius(wireframe);
+
+	if
+	(
+		!Vector3D::isInsideFrustrum
+		(
+			Vector3D::sum(relativePosition, *_cameraPosition), (RightBox){-radius, -radius, -radius, radius, radius, radius}
+		)
+	)
+	{
+		return true;
+	}
+
+#if 0 < __WIREFRAME_MANAGER_LEVEL_OF_DETAIL_DISTANCE
+	uint8 levelOfDetail = 0;
+	fixed_t levelOfDetailDistance = __PIXELS_TO_METERS(__WIREFRAME_MANAGER_LEVEL_OF_DETAIL_DISTANCE);
+
+	while
+	(
+		__WIREFRAME_MANAGER_MAXIMUM_LEVEL_OF_DETAIL > levelOfDetail 
+		&& 
+		__FIXED_SQUARE(levelOfDetailDistance * (levelOfDetail + 1)) < squaredDistanceToCamera
+	)
+	{
+		levelOfDetail++;
+	}
+
+	Wireframe::setLevelOfDetail(wireframe, levelOfDetail);
+#endif
+
+	return false;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 bool WireframeManager::sortProgressively()
 {
 	bool swapped = false;
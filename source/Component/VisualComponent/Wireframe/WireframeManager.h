@@ -23,6 +23,26 @@
 
 class VirtualList;
 
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Maximum distance in pixels to the camera at which wireframes are rendered (0 disables the limit)
+#ifndef __WIREFRAME_MANAGER_DRAW_DISTANCE
+#define __WIREFRAME_MANAGER_DRAW_DISTANCE							0
+#endif
+
+/// Distance in pixels to the camera after which the level of detail of wireframes decreases
+/// by one for each further multiple of it (0 disables the levels of detail)
+#ifndef __WIREFRAME_MANAGER_LEVEL_OF_DETAIL_DISTANCE
+#define __WIREFRAME_MANAGER_LEVEL_OF_DETAIL_DISTANCE				0
+#endif
+
+/// Lowest level of detail that the manager sets
+#ifndef __WIREFRAME_MANAGER_MAXIMUM_LEVEL_OF_DETAIL
+#define __WIREFRAME_MANAGER_MAXIMUM_LEVEL_OF_DETAIL					3
+#endif
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DECLARATION
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -45,6 +65,9 @@ class WireframeManager : ComponentManager
 	/// Number of drawing wireframes during the last game cycle
 	uint8 drawnWireframes;
 
+	/// Number of wireframes culled for being outside the camera's frustum during the last game cycle
+	uint8 culledWireframes;
+
 	/// @publicsection
 
 	/// Class' constructor
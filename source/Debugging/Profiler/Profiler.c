@@ -0,0 +1,494 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+#ifdef __ENABLE_PROFILER
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <string.h>
+
+#include <Communications.h>
+#include <DebugConfig.h>
+#include <Mem.h>
+#include <Printer.h>
+#include <Singleton.h>
+#include <Timer.h>
+
+#include "Profiler.h"
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#define __PROFILER_NO_PHASE						0xFF
+#define __PROFILER_SKIP_FRAMES					2
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PUBLIC STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Profiler::initialize()
+{
+	Profiler profiler = Profiler::getInstance();
+
+	Profiler::reset();
+
+	profiler->initialized = true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Profiler::reset()
+{
+	Profiler profiler = Profiler::getInstance();
+
+	for(int16 i = 0; i < __PROFILER_MAXIMUM_PHASES; i++)
+	{
+		uint16 budgetTicks = profiler->phases[i].budgetTicks;
+		const char* name = profiler->phases[i].name;
+
+		Mem::clear((uint8*)&profiler->phases[i], sizeof(ProfilerPhase));
+
+		// Budgets survive resets since they are usually configured once
+		profiler->phases[i].name = name;
+		profiler->phases[i].budgetTicks = budgetTicks;
+		profiler->phases[i].windowMinimumTicks = 0xFFFF;
+	}
+
+	profiler->interruptTicks = 0;
+	profiler->frameTicks = 0;
+	profiler->interruptFlags = 0;
+	profiler->cycles = 0;
+	profiler->previousTimerCounter = Timer::getCurrentTimerCounter();
+	profiler->interruptTimerCounter = profiler->previousTimerCounter;
+	profiler->traceHead = 0;
+	profiler->traceEntries = 0;
+	profiler->windowFrames = 0;
+	profiler->lastExceededPhase = __PROFILER_NO_PHASE;
+	profiler->skipFrames = __PROFILER_SKIP_FRAMES;
+	profiler->inInterrupt = false;
+	profiler->started = false;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Profiler::start()
+{
+	Profiler profiler = Profiler::getInstance();
+
+	if(!profiler->initialized)
+	{
+		return;
+	}
+
+	if(profiler->started)
+	{
+		Profiler::end();
+	}
+
+	if(0 < profiler->skipFrames)
+	{
+		profiler->skipFrames--;
+		return;
+	}
+
+	profiler->started = true;
+	profiler->frameTicks = 0;
+	profiler->interruptTicks = 0;
+	profiler->interruptFlags = 0;
+	profiler->previousTimerCounter = Timer::getCurrentTimerCounter();
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Profiler::end()
+{
+	Profiler profiler = Profiler::getInstance();
+
+	if(!profiler->started)
+	{
+		return;
+	}
+
+	profiler->started = false;
+	profiler->cycles++;
+
+	for(int16 i = 0; i < profiler->registeredPhases; i++)
+	{
+		ProfilerPhase* phase = &profiler->phases[i];
+
+		if(0 != phase->budgetTicks && phase->budgetTicks < phase->lastTicks)
+		{
+			phase->overBudgetFrames++;
+			profiler->lastExceededPhase = i;
+
+			if(!isDeleted(profiler->events))
+			{
+				Profiler::fireEvent(profiler, kEventProfilerBudgetExceeded);
+			}
+		}
+
+		phase->windowTicks += phase->lastTicks;
+		phase->windowSamples++;
+
+		if(phase->windowMinimumTicks > phase->lastTicks)
+		{
+			phase->windowMinimumTicks = phase->lastTicks;
+		}
+
+		if(phase->windowMaximumTicks < phase->lastTicks)
+		{
+			phase->windowMaximumTicks = phase->lastTicks;
+		}
+
+		phase->lastTicks = 0;
+	}
+
+	if(__PROFILER_WINDOW_FRAMES <= ++profiler->windowFrames)
+	{
+		profiler->windowFrames = 0;
+
+		for(int16 i = 0; i < profiler->registeredPhases; i++)
+		{
+			ProfilerPhase* phase = &profiler->phases[i];
+
+			phase->averageTicks = 0 < phase->windowSamples ? phase->windowTicks / phase->windowSamples : 0;
+			phase->minimumTicks = 0xFFFF == phase->windowMinimumTicks ? 0 : phase->windowMinimumTicks;
+			phase->maximumTicks = phase->windowMaximumTicks;
+			phase->windowTicks = 0;
+			phase->windowSamples = 0;
+			phase->windowMinimumTicks = 0xFFFF;
+			phase->windowMaximumTicks = 0;
+		}
+
+		if(profiler->printStatistics)
+		{
+			Profiler::print(0, 0);
+		}
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Profiler::lap(uint32 lapType, const char* processName)
+{
+	Profiler profiler = Profiler::getInstance();
+
+	if(!profiler->started)
+	{
+		return;
+	}
+
+	uint16 currentTimerCounter = Timer::getCurrentTimerCounter();
+
+	if(kProfilerLapTypeStartInterrupt & lapType)
+	{
+		profiler->inInterrupt = true;
+		profiler->interruptTimerCounter = currentTimerCounter;
+		return;
+	}
+
+	uint8 phaseIndex = Profiler::getPhaseIndex(processName, true);
+
+	if(kProfilerLapTypeNormalProcess != lapType && profiler->inInterrupt)
+	{
+		// Interrupts are attributed to their own phase and subtracted from the interrupted one
+		uint16 elapsedTicks = Profiler::computeElapsedTicks(profiler->interruptTimerCounter, currentTimerCounter);
+
+		profiler->inInterrupt = false;
+		profiler->interruptTicks += elapsedTicks;
+		profiler->interruptFlags |= lapType;
+
+		if(__PROFILER_NO_PHASE != phaseIndex)
+		{
+			profiler->phases[phaseIndex].lastTicks += elapsedTicks;
+			profiler->phases[phaseIndex].lapTypes |= lapType;
+
+			Profiler::trace(phaseIndex, lapType, profiler->frameTicks, elapsedTicks);
+		}
+
+		return;
+	}
+
+	uint32 elapsedTicks = Profiler::computeElapsedTicks(profiler->previousTimerCounter, currentTimerCounter);
+
+	profiler->previousTimerCounter = currentTimerCounter;
+
+	uint32 processTicks = elapsedTicks > profiler->interruptTicks ? elapsedTicks - profiler->interruptTicks : 0;
+
+	if(__PROFILER_NO_PHASE != phaseIndex)
+	{
+		profiler->phases[phaseIndex].lastTicks += processTicks;
+		profiler->phases[phaseIndex].lapTypes |= lapType | profiler->interruptFlags;
+
+		Profiler::trace(phaseIndex, lapType, profiler->frameTicks, processTicks);
+	}
+
+	profiler->frameTicks += elapsedTicks;
+	profiler->interruptTicks = 0;
+	profiler->interruptFlags = 0;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Profiler::setBudget(const char* processName, uint32 budgetUS)
+{
+	Profiler profiler = Profiler::getInstance();
+
+	uint8 phaseIndex = Profiler::getPhaseIndex(processName, true);
+
+	if(__PROFILER_NO_PHASE == phaseIndex)
+	{
+		return;
+	}
+
+	uint16 tickDurationUS = Timer::getResolutionInUS();
+
+	uint32 budgetTicks = 0 < tickDurationUS ? budgetUS / tickDurationUS : budgetUS;
+
+	profiler->phases[phaseIndex].budgetTicks = 0xFFFF < budgetTicks ? 0xFFFF : budgetTicks;
+	profiler->phases[phaseIndex].overBudgetFrames = 0;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static const ProfilerPhase* Profiler::getPhase(const char* processName)
+{
+	Profiler profiler = Profiler::getInstance();
+
+	uint8 phaseIndex = Profiler::getPhaseIndex(processName, false);
+
+	return __PROFILER_NO_PHASE == phaseIndex ? NULL : &profiler->phases[phaseIndex];
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static const ProfilerPhase* Profiler::getLastExceededPhase()
+{
+	Profiler profiler = Profiler::getInstance();
+
+	return __PROFILER_NO_PHASE == profiler->lastExceededPhase ? NULL : &profiler->phases[profiler->lastExceededPhase];
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Profiler::setPrintStatistics(bool printStatistics)
+{
+	Profiler profiler = Profiler::getInstance();
+
+	profiler->printStatistics = printStatistics;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static bool Profiler::dumpTrace()
+{
+	Profiler profiler = Profiler::getInstance();
+
+	ProfilerTraceHeader traceHeader =
+	{
+		__PROFILER_TRACE_MAGIC,
+		Timer::getResolutionInUS(),
+		profiler->traceEntries,
+		profiler->registeredPhases,
+		{0, 0, 0}
+	};
+
+	if(!Communications::broadcastData((uint8*)&traceHeader, sizeof(ProfilerTraceHeader)))
+	{
+		return false;
+	}
+
+	for(int16 i = 0; i < profiler->registeredPhases; i++)
+	{
+		Communications::broadcastData((uint8*)profiler->phases[i].name, strlen(profiler->phases[i].name) + 1);
+	}
+
+	// The ring buffer is sent in two chunks so the entries arrive sorted from oldest to newest
+	uint16 oldestEntry = __PROFILER_TRACE_ENTRIES > profiler->traceEntries ? 0 : profiler->traceHead;
+	uint16 firstChunkEntries = profiler->traceEntries - oldestEntry;
+
+	Communications::broadcastData
+	(
+		(uint8*)&profiler->trace[oldestEntry], firstChunkEntries * sizeof(ProfilerTraceEntry)
+	);
+
+	if(0 < oldestEntry)
+	{
+		Communications::broadcastData((uint8*)&profiler->trace[0], oldestEntry * sizeof(ProfilerTraceEntry));
+	}
+
+	return true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Profiler::print(int32 x, int32 y)
+{
+	Profiler profiler = Profiler::getInstance();
+
+	uint16 tickDurationUS = Timer::getResolutionInUS();
+
+	Printer::text("PROCESS     LAST  MIN  AVG  MAX BUDG", x, y++, NULL);
+
+	for(int16 i = 0; i < profiler->registeredPhases; i++, y++)
+	{
+		ProfilerPhase* phase = &profiler->phases[i];
+
+		Printer::text("                                    ", x, y, NULL);
+		Printer::text(phase->name, x, y, NULL);
+
+		if(0 != (phase->lapTypes & ~kProfilerLapTypeNormalProcess))
+		{
+			Printer::text("*", x + 10, y, NULL);
+		}
+
+		// Print in hundreds of microseconds to keep the columns narrow
+		Printer::int32((phase->lastTicks * tickDurationUS) / 100, x + 12, y, NULL);
+		Printer::int32((phase->minimumTicks * tickDurationUS) / 100, x + 17, y, NULL);
+		Printer::int32((phase->averageTicks * tickDurationUS) / 100, x + 22, y, NULL);
+		Printer::int32((phase->maximumTicks * tickDurationUS) / 100, x + 27, y, NULL);
+
+		if(0 != phase->budgetTicks)
+		{
+			Printer::int32(phase->overBudgetFrames, x + 32, y, NULL);
+		}
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint16 Profiler::computeElapsedTicks(uint16 previousTimerCounter, uint16 currentTimerCounter)
+{
+	// The timer counts down and reloads upon reaching zero
+	if(previousTimerCounter >= currentTimerCounter)
+	{
+		return previousTimerCounter - currentTimerCounter;
+	}
+
+	return previousTimerCounter + (Timer::getTimerCounter() - currentTimerCounter);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint8 Profiler::getPhaseIndex(const char* processName, bool registerPhase)
+{
+	Profiler profiler = Profiler::getInstance();
+
+	if(NULL == processName)
+	{
+		return __PROFILER_NO_PHASE;
+	}
+
+	for(int16 i = 0; i < profiler->registeredPhases; i++)
+	{
+		// Process names are usually literals, so comparing the pointers is enough most of the time
+		if(processName == profiler->phases[i].name || 0 == strcmp(processName, profiler->phases[i].name))
+		{
+			return i;
+		}
+	}
+
+	if(!registerPhase || __PROFILER_MAXIMUM_PHASES <= profiler->registeredPhases)
+	{
+		return __PROFILER_NO_PHASE;
+	}
+
+	uint8 phaseIndex = profiler->registeredPhases++;
+
+	Mem::clear((uint8*)&profiler->phases[phaseIndex], sizeof(ProfilerPhase));
+	profiler->phases[phaseIndex].name = processName;
+	profiler->phases[phaseIndex].windowMinimumTicks = 0xFFFF;
+
+	return phaseIndex;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Profiler::trace(uint8 phaseIndex, uint32 lapType, uint32 startTicks, uint32 durationTicks)
+{
+	Profiler profiler = Profiler::getInstance();
+
+	ProfilerTraceEntry* traceEntry = &profiler->trace[profiler->traceHead];
+
+	uint8 lapTypeIndex = 0;
+
+	for(; 1 < lapType; lapType >>= 1, lapTypeIndex++);
+
+	traceEntry->frame = profiler->cycles;
+	traceEntry->phase = phaseIndex;
+	traceEntry->lapType = lapTypeIndex;
+	traceEntry->startTicks = 0xFFFF < startTicks ? 0xFFFF : startTicks;
+	traceEntry->durationTicks = 0xFFFF < durationTicks ? 0xFFFF : durationTicks;
+
+	if(__PROFILER_TRACE_ENTRIES <= ++profiler->traceHead)
+	{
+		profiler->traceHead = 0;
+	}
+
+	if(__PROFILER_TRACE_ENTRIES > profiler->traceEntries)
+	{
+		profiler->traceEntries++;
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Profiler::constructor()
+{
+	// Always explicitly call the base's constructor
+	Base::constructor();
+
+	Mem::clear((uint8*)this->phases, sizeof(this->phases));
+
+	this->interruptTicks = 0;
+	this->frameTicks = 0;
+	this->interruptFlags = 0;
+	this->cycles = 0;
+	this->previousTimerCounter = 0;
+	this->interruptTimerCounter = 0;
+	this->traceHead = 0;
+	this->traceEntries = 0;
+	this->windowFrames = 0;
+	this->registeredPhases = 0;
+	this->lastExceededPhase = __PROFILER_NO_PHASE;
+	this->skipFrames = __PROFILER_SKIP_FRAMES;
+	this->inInterrupt = false;
+	this->started = false;
+	this->initialized = false;
+	this->printStatistics = true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Profiler::destructor()
+{
+	// Always explicitly call the base's destructor
+	Base::destructor();
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#endif
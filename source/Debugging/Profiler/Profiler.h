@@ -16,6 +16,24 @@
 
 #include <ListenerObject.h>
 
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#ifndef __PROFILER_MAXIMUM_PHASES
+#define __PROFILER_MAXIMUM_PHASES					24
+#endif
+
+#ifndef __PROFILER_WINDOW_FRAMES
+#define __PROFILER_WINDOW_FRAMES					32
+#endif
+
+#ifndef __PROFILER_TRACE_ENTRIES
+#define __PROFILER_TRACE_ENTRIES					256
+#endif
+
+#define __PROFILER_TRACE_MAGIC						0x50455556
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DATA
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -31,37 +49,159 @@ enum ProfilerLapTypes
 	kProfilerLapTypeCommunicationsInterruptProcess				= 0x00000001 << 6,
 };
 
+/// Statistics of a profiled phase
+/// @memberof Profiler
+typedef struct ProfilerPhase
+{
+	/// Name of the phase
+	const char* name;
+
+	/// Lap types that have been registered for this phase
+	uint32 lapTypes;
+
+	/// Ticks accumulated during the current window
+	uint32 windowTicks;
+
+	/// Number of samples taken during the current window
+	uint16 windowSamples;
+
+	/// Minimum ticks during the current window
+	uint16 windowMinimumTicks;
+
+	/// Maximum ticks during the current window
+	uint16 windowMaximumTicks;
+
+	/// Ticks spent during the last game frame
+	uint16 lastTicks;
+
+	/// Minimum ticks during the last completed window
+	uint16 minimumTicks;
+
+	/// Average ticks during the last completed window
+	uint16 averageTicks;
+
+	/// Maximum ticks during the last completed window
+	uint16 maximumTicks;
+
+	/// Maximum ticks allowed per game frame before firing kEventProfilerBudgetExceeded (0 disables it)
+	uint16 budgetTicks;
+
+	/// Number of game frames in which the budget was exceeded
+	uint16 overBudgetFrames;
+
+} ProfilerPhase;
+
+/// Entry of the profiler's trace buffer
+/// @memberof Profiler
+typedef struct ProfilerTraceEntry
+{
+	/// Game frame in which the lap was registered
+	uint16 frame;
+
+	/// Index of the phase
+	uint8 phase;
+
+	/// Lap type's bit index
+	uint8 lapType;
+
+	/// Ticks since the start of the game frame
+	uint16 startTicks;
+
+	/// Duration in ticks
+	uint16 durationTicks;
+
+} ProfilerTraceEntry;
+
+/// Header preceding a dump of the trace buffer
+/// @memberof Profiler
+typedef struct ProfilerTraceHeader
+{
+	/// Always __PROFILER_TRACE_MAGIC
+	uint32 magic;
+
+	/// Microseconds per tick
+	uint16 tickDurationUS;
+
+	/// Number of trace entries that follow the phase names
+	uint16 entries;
+
+	/// Number of null terminated phase names that follow the header
+	uint8 phases;
+
+	/// Padding
+	uint8 padding[3];
+
+} ProfilerTraceHeader;
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DECLARATION
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-/// Class SoundTest
+/// Class Profiler
 ///
 /// Inherits from ListenerObject
 ///
 /// Implements profiler that permits to measure how much time a process takes to complete.
+/// Interrupt handlers should call Profiler::lap(kProfilerLapTypeStartInterrupt, NULL) upon entering and
+/// Profiler::lap(<interrupt lap type>, <process name>) upon leaving so their time is attributed to their
+/// own phase instead of to the game loop's phase that they interrupted.
 singleton class Profiler : ListenerObject
 {
-	/// Laps during the current profiling cycle
-	VirtualList laps;
+	/// @protectedsection
+
+	/// Statistics of the profiled phases
+	ProfilerPhase phases[__PROFILER_MAXIMUM_PHASES];
+
+	/// Ring buffer of laps
+	ProfilerTraceEntry trace[__PROFILER_TRACE_ENTRIES];
+
+	/// Ticks spent in interrupts since the last normal lap
+	uint32 interruptTicks;
 
-	float timeProportion;
-	float lastCycleTotalTime;
-	float totalTime;
+	/// Ticks since the start of the current game frame
+	uint32 frameTicks;
+
+	/// Accumulated lap types during the current lap
 	uint32 interruptFlags;
-	uint32 timePerGameFrameInMS;
+
+	/// Number of profiled game frames
 	uint32 cycles;
-	uint16 timerCounter;
+
+	/// Timer counter at the last lap
 	uint16 previousTimerCounter;
-	uint8 currentProfilingProcess;
+
+	/// Timer counter at the start of the current interrupt
+	uint16 interruptTimerCounter;
+
+	/// Index of the next trace entry to write
+	uint16 traceHead;
+
+	/// Number of valid entries in the trace buffer
+	uint16 traceEntries;
+
+	/// Number of frames in the current window
+	uint16 windowFrames;
+
+	/// Number of registered phases
+	uint8 registeredPhases;
+
+	/// Index of the last phase whose budget was exceeded
+	uint8 lastExceededPhase;
+
+	/// Frames to skip before profiling
+	uint8 skipFrames;
+
+	/// Flag raised while inside an interrupt
+	bool inInterrupt;
+
+	/// Flag raised when a profiling cycle is in course
 	bool started;
+
+	/// Flag raised once the profiler has been initialized
 	bool initialized;
-	bool printedProcessesNames;
-	uint8 skipFrames;
-	uint8 lastLapIndex;
-	bool xpend;
-	bool playedMIDISounds;
-	bool processedCommunications;
+
+	/// If true, the statistics are printed at the end of each window
+	bool printStatistics;
 
 	/// @publicsection
 
@@ -81,6 +221,35 @@ singleton class Profiler : ListenerObject
 	/// @param lapType: Type of lap to record
 	/// @param processName: Name of the process during the lap
 	static void lap(uint32 lapType, const char* processName);
+
+	/// Set the maximum time that a phase can take per game frame before firing kEventProfilerBudgetExceeded.
+	/// @param processName: Name of the process
+	/// @param budgetUS: Budget in microseconds (0 disables the budget)
+	static void setBudget(const char* processName, uint32 budgetUS);
+
+	/// Retrieve the statistics of a phase.
+	/// @param processName: Name of the process
+	/// @return Pointer to the phase's statistics; NULL if the phase has not been registered
+	static const ProfilerPhase* getPhase(const char* processName);
+
+	/// Retrieve the phase whose budget was exceeded the last time that kEventProfilerBudgetExceeded was fired.
+	/// @return Pointer to the phase's statistics; NULL if no budget has been exceeded
+	static const ProfilerPhase* getLastExceededPhase();
+
+	/// Enable or disable the printing of the statistics.
+	/// @param printStatistics: If true, the statistics are printed at the end of each window
+	static void setPrintStatistics(bool printStatistics);
+
+	/// Send the trace buffer over the EXT port.
+	/// The dump consists of a ProfilerTraceHeader, the null terminated phase names
+	/// and the trace entries sorted from oldest to newest.
+	/// @return True if the data was sent
+	static bool dumpTrace();
+
+	/// Print the phases' statistics.
+	/// @param x: Screen x coordinate where to print
+	/// @param y: Screen y coordinate where to print
+	static void print(int32 x, int32 y);
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -80,6 +80,7 @@ void ActorFactory::constructor()
 	this->spawnedActors = new VirtualList();
 
 	this->instantiationPhase = 0;
+	this->processedPositionedActor = NULL;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -187,6 +188,8 @@ void ActorFactory::spawnActor(const PositionedActor* positionedActor, Container
 
 bool ActorFactory::createNextActor()
 {
+	this->processedPositionedActor = NULL;
+
 	if(this->instantiationPhase >= _instantiationPhasesCount)
 	{
 		this->instantiationPhase = 0;
@@ -230,6 +233,13 @@ bool ActorFactory::hasActorsPending()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+const PositionedActor* ActorFactory::getProcessedPositionedActor()
+{
+	return this->processedPositionedActor;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 #ifndef __SHIPPING
 void ActorFactory::print(int32 x, int32 y)
 {	int32 xDisplacement = 18;
@@ -274,6 +284,7 @@ uint32 ActorFactory::instantiateActors()
 	}
 
 	PositionedActorDescription* positionedActorDescription = (PositionedActorDescription*)this->actorsToInstantiate->head->data;
+	this->processedPositionedActor = positionedActorDescription->positionedActor;
 
 	if(!isDeleted(positionedActorDescription->parent))
 	{
@@ -334,6 +345,7 @@ uint32 ActorFactory::transformActors()
 	}
 
 	PositionedActorDescription* positionedActorDescription = (PositionedActorDescription*)this->actorsToTransform->head->data;
+	this->processedPositionedActor = positionedActorDescription->positionedActor;
 	ASSERT(positionedActorDescription->actor, "ActorFactory::transformActors: null actor");
 	ASSERT(positionedActorDescription->parent, "ActorFactory::transformActors: null parent");
 
@@ -416,6 +428,7 @@ uint32 ActorFactory::addChildActors()
 	}
 
 	PositionedActorDescription* positionedActorDescription = (PositionedActorDescription*)this->actorsToAddAsChildren->head->data;
+	this->processedPositionedActor = positionedActorDescription->positionedActor;
 
 	if(!isDeleted(positionedActorDescription->parent))
 	{
@@ -60,6 +60,9 @@ class ActorFactory : Object
 	/// of actors
 	int32 instantiationPhase;
 
+	/// Positioned actor processed by the last call to createNextActor
+	const PositionedActor* processedPositionedActor;
+
 	/// @publicsection
 	
 	/// Class' constructor
@@ -81,6 +84,10 @@ class ActorFactory : Object
 	/// @return True if there are actors pending instantiation; false otherwise
 	bool hasActorsPending();
 
+	/// Retrieve the positioned actor processed by the last call to createNextActor.
+	/// @return Positioned actor processed by the last call to createNextActor; NULL if none
+	const PositionedActor* getProcessedPositionedActor();
+
 	/// Print the factory's state.
 	/// @param x: Screen x coordinate where to print
 	/// @param y: Screen y coordinate where to print
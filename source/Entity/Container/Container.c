@@ -14,6 +14,7 @@
 #include <string.h>
 
 #include <Body.h>
+#include <MemoryPool.h>
 #include <Printer.h>
 #include <VirtualList.h>
 
@@ -26,6 +27,49 @@
 friend class VirtualNode;
 friend class VirtualList;
 
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' ATTRIBUTES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static MessagePropagationStatistics _messagePropagationStatistics = {0, 0, 0};
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PUBLIC STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static MessagePropagationStatistics Container::getMessagePropagationStatistics()
+{
+	return _messagePropagationStatistics;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Container::resetMessagePropagationStatistics()
+{
+	_messagePropagationStatistics.propagations = 0;
+	_messagePropagationStatistics.visitedNodes = 0;
+	_messagePropagationStatistics.handlingNodes = 0;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Container::printMessagePropagationStatistics(int32 x, int32 y)
+{
+	Printer::text("MESSAGE PROPAGATION", x, y++, NULL);
+	y++;
+
+	Printer::text("Messages:     ", x, y, NULL);
+	Printer::int32(_messagePropagationStatistics.propagations, x + 12, y++, NULL);
+	Printer::text("Visited:      ", x, y, NULL);
+	Printer::int32(_messagePropagationStatistics.visitedNodes, x + 12, y++, NULL);
+	Printer::text("Handling:     ", x, y, NULL);
+	Printer::int32(_messagePropagationStatistics.handlingNodes, x + 12, y++, NULL);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' PUBLIC METHODS
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -55,8 +99,15 @@ void Container::constructor(int16 internalId, const char* const name)
 	this->dontStreamOut = false;
 	this->hidden = false;
 	this->axisForSynchronizationWithBody = __ALL_AXIS;
+	this->nameIndex = NULL;
+	this->nextInNameIndex = NULL;
+	this->nameIndexDirty = true;
+	this->subscriptions = NULL;
+	this->subscribedMessages = 0;
+	this->subtreeSubscribedMessages = 0;
 
 	this->name = NULL;
+	this->nameId = __NO_NAME_ID;
 	Container::setName(this, name);
 }
 
@@ -121,10 +172,19 @@ void Container::destructor()
 		Container::removeChild(this->parent, this, false);
 	}
 
-	// Delete name
-	if(!isDeleted(this->name))
+	// Release name
+	Container::releaseName(this);
+
+	if(NULL != this->nameIndex)
 	{
-		delete this->name;
+		delete this->nameIndex;
+		this->nameIndex = NULL;
+	}
+
+	if(!isDeleted(this->subscriptions))
+	{
+		delete this->subscriptions;
+		this->subscriptions = NULL;
 	}
 
 	// Always explicitly call the base's destructor 
@@ -351,9 +411,16 @@ void Container::deleteMyself()
 
 void Container::setName(const char* const name)
 {
-	if(NULL != this->name)
+	if(NULL != name && name == this->name)
 	{
-		delete this->name;
+		return;
+	}
+
+	Container::releaseName(this);
+
+	if(NULL != this->parent)
+	{
+		this->parent->nameIndexDirty = true;
 	}
 
 	if(NULL == name)
@@ -361,6 +428,16 @@ void Container::setName(const char* const name)
 		return;
 	}
 
+	// Interned names are shared and compared by id
+	this->nameId = NameRegistry::intern(name);
+
+	if(__NO_NAME_ID != this->nameId)
+	{
+		this->name = (char*)NameRegistry::getName(this->nameId);
+		return;
+	}
+
+	// Keep a private copy if the registry is full
 	typedef struct NameWrapper
 	{
 		char name[__MAX_CONTAINER_NAME_LENGTH + 1];
@@ -390,6 +467,13 @@ const char* Container::getName()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+NameId Container::getNameId()
+{
+	return this->nameId;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void Container::streamOut(bool streamOut)
 {
 	this->dontStreamOut = !streamOut;
@@ -438,6 +522,13 @@ void Container::addChild(Container child)
 		// Add to the children list
 		VirtualList::pushBack(this->children, (void*)child);
 
+		this->nameIndexDirty = true;
+
+		if(0 != child->subtreeSubscribedMessages)
+		{
+			Container::updateSubtreeSubscriptions(this);
+		}
+
 		if(__NON_TRANSFORMED == child->transformation.invalid || __INVALIDATE_TRANSFORMATION == child->transformation.invalid)
 		{
 			Container::transform(child, &environmentTransformation, __INVALIDATE_TRANSFORMATION);
@@ -467,6 +558,8 @@ void Container::removeChild(Container child, bool deleteChild)
 		return;
 	}
 
+	this->nameIndexDirty = true;
+
 	if(!deleteChild)
 	{
 		if(VirtualList::removeData(this->children, child))
@@ -503,6 +596,11 @@ void Container::removeChild(Container child, bool deleteChild)
 		NM_ASSERT(false, "Container::removeChild: not my child");
 	}
 #endif
+
+	if(0 != child->subtreeSubscribedMessages)
+	{
+		Container::updateSubtreeSubscriptions(this);
+	}
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -543,6 +641,7 @@ bool Container::purgeChildren()
 			delete child;
 
 			purged = true;
+			this->nameIndexDirty = true;
 		}
 		else if(NULL != child->children)
 		{
@@ -611,14 +710,23 @@ Container Container::getChildByName(const char* childName, bool recursive)
 
 	if(!this->deleteMe && NULL != childName && NULL != this->children)
 	{
-		// Search through direct children
-		foundChild = Container::findChildByName(this, this->children, childName, false);
+		// A name that is not in the registry can still belong to a container that failed to intern it
+		foundChild = Container::findChildByName(this, NameRegistry::find(childName), childName, recursive);
+	}
 
-		// If no direct child could be found, do a recursive search, if applicable
-		if(!foundChild && recursive)
-		{
-			foundChild = Container::findChildByName(this, this->children, childName, true);
-		}
+	return !isDeleted(foundChild) && !foundChild->deleteMe ? foundChild : NULL;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+Container Container::getChildByNameId(NameId childNameId, bool recursive)
+{
+	Container foundChild = NULL;
+
+	if(!this->deleteMe && __NO_NAME_ID != childNameId && NULL != this->children)
+	{
+		foundChild = 
+			Container::findChildByName(this, childNameId, NameRegistry::getName(childNameId), recursive);
 	}
 
 	return !isDeleted(foundChild) && !foundChild->deleteMe ? foundChild : NULL;
@@ -796,6 +904,9 @@ bool Container::propagateMessage(bool (*propagatedMessageHandler)(void*, va_list
 
 	va_list args;
 	va_start(args, propagatedMessageHandler);
+#ifdef __DEBUGGING_MESSAGE_PROPAGATION
+	_messagePropagationStatistics.propagations++;
+#endif
 	bool result = Container::propagateArguments(this, propagatedMessageHandler, args);
 	va_end(args);
 
@@ -812,12 +923,73 @@ bool Container::onPropagatedMessage(va_list args)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+void Container::subscribeToMessage(int32 message)
+{
+	if(NULL == this->subscriptions)
+	{
+		this->subscriptions = new VirtualList();
+	}
+
+	if(NULL != VirtualList::find(this->subscriptions, (void*)message))
+	{
+		return;
+	}
+
+	VirtualList::pushBack(this->subscriptions, (void*)message);
+
+	this->subscribedMessages |= __MESSAGE_SUBSCRIPTION_BIT(message);
+
+	Container::updateSubtreeSubscriptions(this);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Container::unsubscribeFromMessage(int32 message)
+{
+	if(NULL == this->subscriptions || !VirtualList::removeData(this->subscriptions, (void*)message))
+	{
+		return;
+	}
+
+	// Other subscribed messages might share the bit
+	this->subscribedMessages = 0;
+
+	for(VirtualNode node = this->subscriptions->head; NULL != node; node = node->next)
+	{
+		this->subscribedMessages |= __MESSAGE_SUBSCRIPTION_BIT((int32)node->data);
+	}
+
+	if(NULL == this->subscriptions->head)
+	{
+		delete this->subscriptions;
+		this->subscriptions = NULL;
+	}
+
+	Container::updateSubtreeSubscriptions(this);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+bool Container::propagateSubscribedMessage(int32 message)
+{
+#ifdef __DEBUGGING_MESSAGE_PROPAGATION
+	_messagePropagationStatistics.propagations++;
+#endif
+
+	return Container::propagateToSubscribers(this, message, __MESSAGE_SUBSCRIPTION_BIT(message));
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 bool Container::propagateString(bool (*propagatedStringHandler)(void*, va_list), ...)
 {
 	ASSERT(propagatedStringHandler, "Container::propagateMessage: null propagatedStringHandler");
 
 	va_list args;
 	va_start(args, propagatedStringHandler);
+#ifdef __DEBUGGING_MESSAGE_PROPAGATION
+	_messagePropagationStatistics.propagations++;
+#endif
 	bool result = Container::propagateArguments(this, propagatedStringHandler, args);
 	va_end(args);
 
@@ -1111,15 +1283,64 @@ void Container::changeEnvironment(Transformation* environmentTransformation)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-Container Container::findChildByName(VirtualList children, const char* childName, bool recursive)
+Container Container::findChildByName(NameId childNameId, const char* childName, bool recursive)
+{
+	if(this->deleteMe || NULL == this->children)
+	{
+		return NULL;
+	}
+
+	// Search through direct children first
+	Container child = Container::findDirectChildByName(this, childNameId, childName);
+
+	if(NULL != child || !recursive)
+	{
+		return child;
+	}
+
+	// Then through grand children
+	for(VirtualNode node = this->children->head; NULL != node; node = node->next)
+	{
+		child = Container::safeCast(node->data);
+
+		if(child->deleteMe || NULL == child->children)
+		{
+			continue;
+		}
+
+		Container grandChild = Container::findChildByName(child, childNameId, childName, recursive);
+		
+		if(!isDeleted(grandChild))
+		{
+			return grandChild;
+		}
+	}
+
+	return NULL;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+Container Container::findDirectChildByName(NameId childNameId, const char* childName)
 {
-	if(this->deleteMe || NULL == children || NULL == childName)
+	if(__NO_NAME_ID != childNameId && Container::updateNameIndex(this))
 	{
+		Container child = this->nameIndex[childNameId & (__CONTAINER_NAME_INDEX_SIZE - 1)];
+
+		for(; NULL != child; child = child->nextInNameIndex)
+		{
+			// Children marked for deletion stay indexed until they are purged, so they must not
+			// shadow a live sibling with the same name
+			if(childNameId == child->nameId && !child->deleteMe)
+			{
+				return child;
+			}
+		}
+
 		return NULL;
 	}
 
-	// Look through all children
-	for(VirtualNode node = children->head; NULL != node; node = node->next)
+	for(VirtualNode node = this->children->head; NULL != node; node = node->next)
 	{
 		Container child = Container::safeCast(node->data);
 
@@ -1128,22 +1349,113 @@ Container Container::findChildByName(VirtualList children, const char* childName
 			continue;
 		}
 
-		if(NULL != child->name && !strncmp(childName, child->name, __MAX_CONTAINER_NAME_LENGTH))
+		if(__NO_NAME_ID != child->nameId)
+		{
+			if(childNameId == child->nameId)
+			{
+				return child;
+			}
+		}
+		else if(NULL != child->name && NULL != childName && !strncmp(childName, child->name, __MAX_CONTAINER_NAME_LENGTH))
 		{
 			return child;
 		}
-		else if(recursive && NULL != child->children)
+	}
+
+	return NULL;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+bool Container::updateNameIndex()
+{
+	if(!this->nameIndexDirty)
+	{
+		return NULL != this->nameIndex;
+	}
+
+	this->nameIndexDirty = false;
+
+	bool indexable = NULL != this->children;
+
+	if(indexable)
+	{
+		for(VirtualNode node = this->children->head; NULL != node; node = node->next)
 		{
-			Container grandChild = Container::findChildByName(this, child->children, childName, recursive);
-			
-			if(!isDeleted(grandChild))
+			Container child = Container::safeCast(node->data);
+
+			// Children with names that could not be interned can only be found by comparing strings
+			if(!child->deleteMe && __NO_NAME_ID == child->nameId && NULL != child->name)
 			{
-				return grandChild;
+				indexable = false;
+				break;
 			}
 		}
 	}
 
-	return NULL;
+	if(!indexable || __CONTAINER_NAME_INDEX_MINIMUM_CHILDREN > VirtualList::getCount(this->children))
+	{
+		if(NULL != this->nameIndex)
+		{
+			delete this->nameIndex;
+			this->nameIndex = NULL;
+		}
+
+		return false;
+	}
+
+	if(NULL == this->nameIndex)
+	{
+		this->nameIndex = 
+			(Container*)
+			(
+				(uint32)MemoryPool::allocate(sizeof(Container) * __CONTAINER_NAME_INDEX_SIZE + __DYNAMIC_STRUCT_PAD) + __DYNAMIC_STRUCT_PAD
+			);
+	}
+
+	for(int16 i = 0; i < __CONTAINER_NAME_INDEX_SIZE; i++)
+	{
+		this->nameIndex[i] = NULL;
+	}
+
+	// Children are chained from the last one so each chain keeps the list's order and the first child
+	// with a name is found first, as the linear search does; since chains grow as needed, the index
+	// never fills up no matter how many children are named
+	for(VirtualNode node = this->children->tail; NULL != node; node = node->previous)
+	{
+		Container child = Container::safeCast(node->data);
+
+		child->nextInNameIndex = NULL;
+
+		if(child->deleteMe || __NO_NAME_ID == child->nameId)
+		{
+			continue;
+		}
+
+		uint16 slot = child->nameId & (__CONTAINER_NAME_INDEX_SIZE - 1);
+
+		child->nextInNameIndex = this->nameIndex[slot];
+		this->nameIndex[slot] = child;
+	}
+
+	return true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Container::releaseName()
+{
+	if(__NO_NAME_ID != this->nameId)
+	{
+		NameRegistry::release(this->nameId);
+	}
+	else if(!isDeleted(this->name))
+	{
+		delete this->name;
+	}
+
+	this->name = NULL;
+	this->nameId = __NO_NAME_ID;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -1352,6 +1664,11 @@ bool Container::propagateArguments(bool (*propagationHandler)(void*, va_list), v
 		return false;
 	}
 
+#ifdef __DEBUGGING_MESSAGE_PROPAGATION
+	_messagePropagationStatistics.visitedNodes++;
+	_messagePropagationStatistics.handlingNodes++;
+#endif
+
 	if(propagationHandler(this, args))
 	{
 		// Stop propagation
@@ -1376,3 +1693,82 @@ bool Container::propagateArguments(bool (*propagationHandler)(void*, va_list), v
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+bool Container::propagateToSubscribers(int32 message, uint32 subscriptionBit)
+{
+#ifdef __DEBUGGING_MESSAGE_PROPAGATION
+	_messagePropagationStatistics.visitedNodes++;
+#endif
+
+	if
+	(
+		0 != (this->subscribedMessages & subscriptionBit) 
+		&& 
+		NULL != VirtualList::find(this->subscriptions, (void*)message)
+	)
+	{
+#ifdef __DEBUGGING_MESSAGE_PROPAGATION
+		_messagePropagationStatistics.handlingNodes++;
+#endif
+
+		if(Container::handlePropagatedMessage(this, message))
+		{
+			// Stop propagation
+			return true;
+		}
+	}
+
+	if(NULL != this->children)
+	{
+		for(VirtualNode node = this->children->head; NULL != node; node = node->next)
+		{
+			Container child = Container::safeCast(node->data);
+
+			// Skip the branches without subscribers
+			if(child->deleteMe || 0 == (child->subtreeSubscribedMessages & subscriptionBit))
+			{
+				continue;
+			}
+
+			if(Container::propagateToSubscribers(child, message, subscriptionBit))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Container::updateSubtreeSubscriptions()
+{
+	for(Container container = this; NULL != container; container = container->parent)
+	{
+		uint32 subtreeSubscribedMessages = container->subscribedMessages;
+
+		if(NULL != container->children)
+		{
+			for(VirtualNode node = container->children->head; NULL != node; node = node->next)
+			{
+				Container child = Container::safeCast(node->data);
+
+				if(!child->deleteMe)
+				{
+					subtreeSubscribedMessages |= child->subtreeSubscribedMessages;
+				}
+			}
+		}
+
+		// The ancestors' masks only depend on this one
+		if(subtreeSubscribedMessages == container->subtreeSubscribedMessages)
+		{
+			break;
+		}
+
+		container->subtreeSubscribedMessages = subtreeSubscribedMessages;
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
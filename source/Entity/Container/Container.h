@@ -15,6 +15,7 @@
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 #include <Entity.h>
+#include <NameRegistry.h>
 #include <stdarg.h>
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -27,7 +28,40 @@ class VirtualList;
 // CLASS' MACROS
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-#define __MAX_CONTAINER_NAME_LENGTH			16
+#define __MAX_CONTAINER_NAME_LENGTH			__NAME_REGISTRY_MAXIMUM_NAME_LENGTH
+
+/// Number of chains of the containers' name indexes, must be a power of 2
+#ifndef __CONTAINER_NAME_INDEX_SIZE
+#define __CONTAINER_NAME_INDEX_SIZE				16
+#endif
+
+/// Minimum number of children that a container must have to index them by name
+#ifndef __CONTAINER_NAME_INDEX_MINIMUM_CHILDREN
+#define __CONTAINER_NAME_INDEX_MINIMUM_CHILDREN	6
+#endif
+
+/// Bit of the message subscription masks to which a message code maps; codes that share a bit are told
+/// apart through the containers' lists of subscribed messages
+#define __MESSAGE_SUBSCRIPTION_BIT(message)		(1 << ((uint32)(message) & 31))
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DATA
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Message propagation statistics
+/// @memberof Container
+typedef struct MessagePropagationStatistics
+{
+	/// Number of propagated messages
+	uint32 propagations;
+
+	/// Number of containers visited while propagating the messages
+	uint32 visitedNodes;
+
+	/// Number of containers whose handlers were called while propagating the messages
+	uint32 handlingNodes;
+
+} MessagePropagationStatistics;
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DECLARATION
@@ -55,6 +89,25 @@ abstract class Container : Entity
 
 	/// Container's name
 	char* name;
+
+	/// Heads of the chains of children that hash to the same slot by their name ids, built
+	/// on demand for containers with many children
+	Container* nameIndex;
+
+	/// Next sibling in the chain of the parent's name index
+	Container nextInNameIndex;
+
+	/// Id of the container's interned name
+	NameId nameId;
+
+	/// Codes of the messages to which the container subscribed
+	VirtualList subscriptions;
+
+	/// Mask of the messages to which the container subscribed
+	uint32 subscribedMessages;
+
+	/// Mask of the messages to which the container or any of its descendants subscribed
+	uint32 subtreeSubscribedMessages;
 	
 	/// Container's internal id, set by the engine
 	int16 internalId;
@@ -77,8 +130,23 @@ abstract class Container : Entity
 	/// Flag to purge children
 	bool pendingChildrenPurging:1;
 
+	/// Flag to rebuild the name index before the next lookup by name
+	bool nameIndexDirty:1;
+
 	/// @publicsection
 
+	/// Retrieve the statistics of the messages propagated through all the containers.
+	/// @return Message propagation statistics
+	static MessagePropagationStatistics getMessagePropagationStatistics();
+
+	/// Reset the message propagation statistics.
+	static void resetMessagePropagationStatistics();
+
+	/// Print the message propagation statistics.
+	/// @param x: Screen x coordinate where to print
+	/// @param y: Screen y coordinate where to print
+	static void printMessagePropagationStatistics(int32 x, int32 y);
+
 	/// Class' constructor
 	/// @param internalId: ID to keep track internally of the new instance
 	/// @param name: Name to assign to the new instance
@@ -130,10 +198,14 @@ abstract class Container : Entity
 	/// @param name: Name to assign to the instance
 	void setName(const char* const name);
 
-	/// Retrive the container's name.
+	/// Retrieve the container's name.
 	/// @return Pointer to the container's name
 	const char* getName();
 
+	/// Retrieve the id of the container's interned name.
+	/// @return Id of the container's name; __NO_NAME_ID if it has no name or it could not be interned
+	NameId getNameId();
+
 	/// Set the streaming effects on this container.
 	/// @param streamOut: If false, this container won't be streamed out when
 	/// outside of the camera's reach
@@ -174,6 +246,12 @@ abstract class Container : Entity
 	/// @return The first child container whose name equals the provided one 
 	Container getChildByName(const char* childName, bool recursive);
 
+	/// Find a child whose interned name has the provided id.
+	/// @param childNameId: Id of the name to look for, as returned by NameRegistry::find
+	/// @param recursive: If true, the seach extends to grand children, grand grand children, etc.
+	/// @return The first child container whose name id equals the provided one 
+	Container getChildByNameId(NameId childNameId, bool recursive);
+
 	/// Retrieve the child at the provided position in the linked list of children.
 	/// @param position: Position in the linked list of children
 	/// @return The child container at the provided position if any
@@ -220,6 +298,20 @@ abstract class Container : Entity
 	/// @param args: Variable list of propagated arguments
 	bool onPropagatedMessage(va_list args);
 
+	/// Subscribe the container to a message propagated with propagateSubscribedMessage.
+	/// @param message: The message to subscribe to
+	void subscribeToMessage(int32 message);
+
+	/// Unsubscribe the container from a message propagated with propagateSubscribedMessage.
+	/// @param message: The message to unsubscribe from
+	void unsubscribeFromMessage(int32 message);
+
+	/// Propagate an integer message through the parenting hierarchy (children, grand children, etc.), 
+	/// only descending into the branches that contain containers subscribed to it.
+	/// @param message: The message to propagate
+	/// @return True if a subscribed container's handlePropagatedMessage stopped the propagation
+	bool propagateSubscribedMessage(int32 message);
+
 	/// Propagate a string through the whole parenting hierarchy (children, grand children, etc.).
 	/// @param propagatedMessageHandler: Method that handles the string
 	/// @param ...: Variable arguments list depending on the string
@@ -21,6 +21,8 @@
 #include <Hardware.h>
 #include <Printer.h>
 #include <SoundManager.h>
+#include <Sprite.h>
+#include <StreamingTelemetry.h>
 #include <TextureManager.h>
 #include <UIContainer.h>
 #include <VirtualList.h>
@@ -45,6 +47,50 @@ friend class VirtualList;
 
 #define __STREAMING_CYCLES		5
 
+/// Game frames over which the predictive streaming extrapolates the camera's motion
+#ifndef __STREAMING_PREDICTION_FRAMES
+#define __STREAMING_PREDICTION_FRAMES					16
+#endif
+
+/// Maximum distance, in pixels, along each axis that the predictive streaming looks ahead
+#ifndef __STREAMING_PREDICTION_MAXIMUM_LOOK_AHEAD
+#define __STREAMING_PREDICTION_MAXIMUM_LOOK_AHEAD		192
+#endif
+
+/// Actors predicted to become visible in fewer game frames than these jump the actor factory's queue
+#ifndef __STREAMING_PREDICTION_URGENT_FRAMES
+#define __STREAMING_PREDICTION_URGENT_FRAMES			4
+#endif
+
+/// Value returned for actors that are not going to become visible
+#define __STREAMING_NEVER_VISIBLE						0xFFFF
+
+/// Minimum distance, in pixels, between the ranges where actors are streamed in and out
+#ifndef __STREAMING_HYSTERESIS_PADDING
+#define __STREAMING_HYSTERESIS_PADDING					16
+#endif
+
+/// Game frames that a streamed in actor stays loaded before it can be streamed out
+#ifndef __STREAMING_MINIMUM_RESIDENT_FRAMES
+#define __STREAMING_MINIMUM_RESIDENT_FRAMES				30
+#endif
+
+/// Maximum number of recently streamed out actors whose shared tile sets are kept resident
+#ifndef __STREAMING_RECENTLY_UNLOADED_ACTORS
+#define __STREAMING_RECENTLY_UNLOADED_ACTORS			8
+#endif
+
+/// Game frames that the shared tile sets of a streamed out actor are kept resident
+#ifndef __STREAMING_RECENTLY_UNLOADED_FRAMES
+#define __STREAMING_RECENTLY_UNLOADED_FRAMES			120
+#endif
+
+/// Maximum number of shared tile sets kept resident per recently streamed out actor
+#define __STREAMING_RECENTLY_UNLOADED_TILE_SETS			2
+
+/// Number of phases that the streaming cycles through
+#define __STREAMING_PHASES								4
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DATA
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -57,6 +103,20 @@ typedef struct ActorLoadingListener
 
 } ActorLoadingListener;
 
+/// @memberof Stage
+typedef struct RecentlyUnloadedActor
+{
+	/// Positioned actor that was streamed out
+	const PositionedActor* positionedActor;
+
+	/// Shared tile sets kept resident on behalf of the streamed out actor
+	TileSet tileSets[__STREAMING_RECENTLY_UNLOADED_TILE_SETS];
+
+	/// Stage's streaming frame when the actor was streamed out
+	uint16 unloadFrame;
+
+} RecentlyUnloadedActor;
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' ATTRIBUTES
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -97,6 +157,37 @@ static uint32 Stage::computeDistanceToOrigin(StageActorDescription* stageActorDe
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+static uint16 Stage::computeFramesToOverlap(fixed_t low, fixed_t high, fixed_t frustumLow, fixed_t frustumHigh, fixed_t speed)
+{
+	fixed_t gap = 0;
+
+	// The camera has to move toward the interval for it to become visible
+	if(low > frustumHigh)
+	{
+		gap = low - frustumHigh;
+	}
+	else if(high < frustumLow)
+	{
+		gap = frustumLow - high;
+		speed = -speed;
+	}
+	else
+	{
+		return 0;
+	}
+
+	if(0 >= speed)
+	{
+		return __STREAMING_NEVER_VISIBLE;
+	}
+
+	fixed_t frames = gap / speed;
+
+	return __STREAMING_NEVER_VISIBLE <= frames ? __STREAMING_NEVER_VISIBLE : (uint16)frames;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' PUBLIC METHODS
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -117,10 +208,27 @@ void Stage::constructor(StageSpec *stageSpec)
 	this->streamingHeadNode = NULL;
 	this->nextActorId = 0;
 	this->streamingPhase = 0;
+	this->idleStreamingPhases = 0;
+	this->streamingInSteps = false;
 	this->streamingAmplitude = this->stageSpec->streaming.streamingAmplitude;
 	this->reverseStreaming = false;
 	this->cameraTransformation.position = Vector3D::getFromPixelVector(this->stageSpec->level.cameraInitialPosition);
 	this->cameraTransformation.rotation = Rotation::zero();
+	this->cameraVelocity = Vector3D::zero();
+	this->streamingLookAhead = Vector3D::zero();
+	this->lateSpawns = 0;
+	this->recentlyUnloadedActors = new VirtualList();
+	this->streamingChurn = new VirtualList();
+	this->hysteresisPadding = __STREAMING_HYSTERESIS_PADDING;
+	this->minimumResidentFrames = __STREAMING_MINIMUM_RESIDENT_FRAMES;
+	this->streamingFrame = 0;
+	this->predictiveStreaming = false;
+
+	// The cached tile sets must not make the allocation of those of new actors fail
+	TileSetManager::setReclaimer
+	(
+		TileSetManager::getInstance(), Object::safeCast(this), (TileSetReclaimer)&Stage::reclaimTileSets
+	);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -151,6 +259,23 @@ void Stage::destructor()
 		this->stageActorDescriptions = NULL;
 	}
 
+	TileSetManager::removeReclaimer(TileSetManager::getInstance(), Object::safeCast(this));
+
+	if(!isDeleted(this->recentlyUnloadedActors))
+	{
+		Stage::expireUnloadedActors(this, true);
+
+		delete this->recentlyUnloadedActors;
+		this->recentlyUnloadedActors = NULL;
+	}
+
+	if(!isDeleted(this->streamingChurn))
+	{
+		VirtualList::deleteData(this->streamingChurn);
+		delete this->streamingChurn;
+		this->streamingChurn = NULL;
+	}
+
 	// Always explicitly call the base's destructor 
 	Base::destructor();
 }
@@ -159,6 +284,9 @@ void Stage::destructor()
 
 void Stage::suspend()
 {
+	// The graphics memory might be reset while suspended
+	Stage::expireUnloadedActors(this, true);
+
 	Base::suspend(this);
 
 	// Save the camera position for resume reconfiguration
@@ -205,6 +333,21 @@ void Stage::resume()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+void Stage::update()
+{
+	Base::update(this);
+
+	this->streamingFrame++;
+
+	// The streaming can run several times per game frame, but the camera only moves once
+	if(this->predictiveStreaming)
+	{
+		Stage::predictCameraMotion(this);
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 const StageSpec* Stage::getSpec()
 {
 	return this->stageSpec;
@@ -442,6 +585,40 @@ void Stage::print(int32 x, int32 y)
 	Printer::text("Factory:          ", x, ++y, NULL);
 	Printer::int32(actorFactoryHighestTime, x + xDisplacement, y++, NULL);
 
+	Printer::text("Late spawns:      ", x, ++y, NULL);
+	Printer::int32(this->lateSpawns, x + xDisplacement, y++, NULL);
+
+	uint32 unloads = 0;
+	uint32 reloads = 0;
+	StreamingChurn* worstStreamingChurn = NULL;
+
+	for(VirtualNode node = this->streamingChurn->head; NULL != node; node = node->next)
+	{
+		StreamingChurn* streamingChurn = (StreamingChurn*)node->data;
+
+		unloads += streamingChurn->unloads;
+		reloads += streamingChurn->reloads;
+
+		if(NULL == worstStreamingChurn || worstStreamingChurn->reloads < streamingChurn->reloads)
+		{
+			worstStreamingChurn = streamingChurn;
+		}
+	}
+
+	Printer::text("Unloads:          ", x, y, NULL);
+	Printer::int32(unloads, x + xDisplacement, y++, NULL);
+	Printer::text("Reloads:          ", x, y, NULL);
+	Printer::int32(reloads, x + xDisplacement, y++, NULL);
+	Printer::text("Cached:           ", x, y, NULL);
+	Printer::int32(VirtualList::getCount(this->recentlyUnloadedActors), x + xDisplacement, y++, NULL);
+
+	if(NULL != worstStreamingChurn && 0 < worstStreamingChurn->reloads)
+	{
+		Printer::text("Worst:            ", x, y, NULL);
+		Printer::hex((uint32)worstStreamingChurn->actorSpec, x + xDisplacement, y, 8, NULL);
+		Printer::int32(worstStreamingChurn->reloads, x + xDisplacement + 9, y++, NULL);
+	}
+
 	unloadOutOfRangeActorsHighestTime = 0;
 	loadInRangeActorsHighestTime = 0;
 	processRemovedActorsHighestTime = 0;
@@ -456,14 +633,75 @@ void Stage::print(int32 x, int32 y)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+void Stage::setPredictiveStreaming(bool predictiveStreaming)
+{
+	this->predictiveStreaming = predictiveStreaming;
+	this->cameraVelocity = Vector3D::zero();
+	this->streamingLookAhead = Vector3D::zero();
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+uint32 Stage::getLateSpawns()
+{
+	return this->lateSpawns;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+uint8 Stage::getStreamingPhase()
+{
+	return this->streamingPhase;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Stage::setStreamingHysteresis(uint16 hysteresisPadding, uint16 minimumResidentFrames)
+{
+	this->hysteresisPadding = hysteresisPadding;
+	this->minimumResidentFrames = minimumResidentFrames;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+const StreamingChurn* Stage::getStreamingChurn(const ActorSpec* actorSpec)
+{
+	return Stage::findStreamingChurn(this, actorSpec, false);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+bool Stage::reclaimTileSets()
+{
+	if(isDeleted(this->recentlyUnloadedActors) || NULL == this->recentlyUnloadedActors->head)
+	{
+		return false;
+	}
+
+	Stage::expireUnloadedActors(this, true);
+
+	return true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void Stage::resetStreaming()
 {
 	this->streamingPhase = 0;
 
+	// Don't extrapolate jumps of the camera
+	this->cameraVelocity = Vector3D::zero();
+	this->streamingLookAhead = Vector3D::zero();
+
+	// The actors in range are loaded at once before anything is shown, so they don't count as late spawns
+	uint32 lateSpawns = this->lateSpawns;
+
 	while(Stage::unloadOutOfRangeActors(this, false));
 	while(Stage::purgeActors(this, false));
 	while(Stage::loadInRangeActors(this, false));
 	while(Stage::updateActorFactory(this, false));
+
+	this->lateSpawns = lateSpawns;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -473,7 +711,7 @@ bool Stage::stream()
 	bool result = false;
 	uint8 streamingPhase = this->streamingPhase;
 
-	static const StreamingPhase streamingPhases[] =
+	static const StreamingPhase streamingPhases[__STREAMING_PHASES] =
 	{
 		&Stage::unloadOutOfRangeActors,
 		&Stage::purgeActors,
@@ -490,18 +728,46 @@ bool Stage::stream()
 			break;
 		}
 
-		if(++this->streamingPhase >= sizeof(streamingPhases) / sizeof(StreamingPhase))
+		if(++this->streamingPhase >= __STREAMING_PHASES)
 		{
 			this->streamingPhase = 0;
 		}
 
-	} while(!VUEngine::hasGameFrameStarted() && streamingPhase != this->streamingPhase);
+	} while(!this->streamingInSteps && !VUEngine::hasGameFrameStarted() && streamingPhase != this->streamingPhase);
 
 	return result;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+bool Stage::streamStep()
+{
+	// A single phase that streams a single actor at most, so the step's duration is bounded
+	this->streamingInSteps = true;
+
+	bool result = Stage::stream(this);
+
+	this->streamingInSteps = false;
+
+	if(result)
+	{
+		this->idleStreamingPhases = 0;
+		return true;
+	}
+
+	// There may be pending work until every phase has been run without finding any
+	if(__STREAMING_PHASES > ++this->idleStreamingPhases)
+	{
+		return true;
+	}
+
+	this->idleStreamingPhases = 0;
+
+	return false;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void Stage::configure(VirtualList positionedActorsToIgnore)
 {
 	Stage::configureCamera(this, true);
@@ -537,6 +803,8 @@ bool Stage::unloadOutOfRangeActors(int32 defer __attribute__((unused)))
 
 	bool unloadedActors = false;
 
+	Stage::expireUnloadedActors(this, false);
+
 	VirtualNode node = this->children->head;
 
 	// Check which entites must be unloaded
@@ -553,7 +821,28 @@ bool Stage::unloadOutOfRangeActors(int32 defer __attribute__((unused)))
 		// If the actor isn't visible inside the view field, unload it
 		if(!actor->deleteMe && actor->parent == Container::safeCast(this))
 		{
-			if(Actor::isInCameraRange(actor, this->stageSpec->streaming.loadPadding + this->stageSpec->streaming.unloadPadding, true))
+			// The unload range is the load range, swept along the look ahead when the streaming is
+			// predictive, grown by the hysteresis padding so actors at the boundary don't thrash
+			int16 padding = 
+				this->stageSpec->streaming.loadPadding 
+				+ 
+				Math::max(this->stageSpec->streaming.unloadPadding, this->hysteresisPadding);
+
+			// Actors left behind by the camera are unloaded sooner
+			if
+			(
+				this->predictiveStreaming 
+				&& 
+				0 > Vector3D::dotProduct(Vector3D::sub(*Actor::getPosition(actor), *_cameraPosition), this->cameraVelocity)
+			)
+			{
+				padding = 
+					this->stageSpec->streaming.loadPadding 
+					+ 
+					Math::max(this->stageSpec->streaming.unloadPadding >> 1, this->hysteresisPadding);
+			}
+
+			if(Stage::isActorInUnloadRange(this, actor, padding))
 			{
 				continue;
 			}
@@ -579,12 +868,38 @@ bool Stage::unloadOutOfRangeActors(int32 defer __attribute__((unused)))
 					continue;
 				}
 
+				// Give recently streamed in actors some time before streaming them out
+				if(this->minimumResidentFrames > (uint16)(this->streamingFrame - stageActorDescription->loadFrame))
+				{
+					continue;
+				}
+
 				stageActorDescription->internalId = -1;
+
+				if(Actor::alwaysStreamIn(actor))
+				{
+					Stage::cacheUnloadedActor(this, stageActorDescription->positionedActor, actor);
+				}
 			}
 
+#ifdef __ENABLE_STREAMING_TELEMETRY
+			StreamingTelemetrySample startSample = StreamingTelemetry::startSample();
+			const ActorSpec* actorSpec = Actor::getSpec(actor);
+			int16 internalId = actor->internalId;
+#endif
+
 			// Unload it
 			Stage::destroyChildActor(this, actor);
 
+#ifdef __ENABLE_STREAMING_TELEMETRY
+			StreamingTelemetry::record
+			(
+				kStreamingTelemetryUnload, this->streamingPhase, 
+				NULL != stageActorDescription ? stageActorDescription->positionedActor : NULL, actorSpec, internalId, 
+				startSample
+			);
+#endif
+
 			// Remove from list of actors that are to be loaded by the streaming,
 			// If the actor is not to be alwaysStreamIned
 			if(!Actor::alwaysStreamIn(actor))
@@ -593,6 +908,11 @@ bool Stage::unloadOutOfRangeActors(int32 defer __attribute__((unused)))
 			}
 
 			unloadedActors = true;
+
+			if(this->streamingInSteps)
+			{
+				break;
+			}
 		}
 	}
 
@@ -635,35 +955,11 @@ bool Stage::loadInRangeActors(int32 defer)
 
 			if(0 > stageActorDescription->internalId)
 			{
-				// If actor in load range
-				if
-				(
-					Stage::isActorInLoadRange
-					(
-						this, stageActorDescription->positionedActor->onScreenPosition, stageActorDescription->validRightBox ? 
-						&stageActorDescription->rightBox : NULL
-					)
-				)
-				{
-					loadedActors = true;
-
-					stageActorDescription->internalId = this->nextActorId++;
+				loadedActors |= Stage::loadActor(this, stageActorDescription, defer);
 
-					if(defer)
-					{
-						ActorFactory::spawnActor
-						(
-							this->actorFactory, stageActorDescription->positionedActor, Container::safeCast(this), 
-							stageActorDescription->internalId, false
-						);
-					}
-					else
-					{
-						Stage::doAddChildActor
-						(
-							this, stageActorDescription->positionedActor, false, stageActorDescription->internalId
-						);
-					}
+				if(loadedActors && this->streamingInSteps)
+				{
+					break;
 				}
 			}
 		}
@@ -693,36 +989,11 @@ bool Stage::loadInRangeActors(int32 defer)
 
 			if(0 > stageActorDescription->internalId)
 			{
-				// If actor in load range
-				if
-				(
-					Stage::isActorInLoadRange
-					(
-						this, stageActorDescription->positionedActor->onScreenPosition, 
-						stageActorDescription->validRightBox ? 
-							&stageActorDescription->rightBox : NULL
-					)
-				)
-				{
-					loadedActors = true;
+				loadedActors |= Stage::loadActor(this, stageActorDescription, defer);
 
-					stageActorDescription->internalId = this->nextActorId++;
-
-					if(defer)
-					{
-						ActorFactory::spawnActor
-						(
-							this->actorFactory, stageActorDescription->positionedActor, Container::safeCast(this), 
-							stageActorDescription->internalId, false
-						);
-					}
-					else
-					{
-						Stage::doAddChildActor
-						(
-							this, stageActorDescription->positionedActor, false, stageActorDescription->internalId
-						);
-					}
+				if(loadedActors && this->streamingInSteps)
+				{
+					break;
 				}
 			}
 		}
@@ -868,39 +1139,490 @@ void Stage::alertOfLoadedActor(Actor actor)
 
 int32 Stage::isActorInLoadRange(ScreenPixelVector onScreenPosition, const RightBox* rightBox)
 {
+	RightBox helperRightBox;
+
 	if(NULL == rightBox)
 	{
 		fixed_t padding = __PIXELS_TO_METERS(this->stageSpec->streaming.loadPadding) >> 1;
 		
-		RightBox helperRightBox =
+		helperRightBox = (RightBox)
 		{
-			-padding, padding,
-			-padding, padding,
-			-padding, padding
+			-padding, -padding, -padding,
+			padding, padding, padding
 		};
+	}
+	else
+	{
+		helperRightBox = *rightBox;
+	}
+
+	if(this->predictiveStreaming)
+	{
+		// Sweep the box against the camera's predicted motion so the actors ahead of it get loaded earlier
+		Stage::sweepRightBox(this, &helperRightBox);
+	}
+
+	return Actor::isInsideFrustrum(Vector3D::getFromScreenPixelVector(onScreenPosition), helperRightBox);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+bool Stage::isActorInUnloadRange(Actor actor, int16 padding)
+{
+	if(Actor::isInCameraRange(actor, padding, true))
+	{
+		return true;
+	}
+
+	if(!this->predictiveStreaming)
+	{
+		return false;
+	}
+
+	// Actors ahead of the camera were loaded through the look ahead, so it must keep them too
+	Vector3D centerDisplacement = NULL != actor->centerDisplacement ? *actor->centerDisplacement : Vector3D::zero();
+	fixed_t paddingHelper = __PIXELS_TO_METERS(padding);
+
+	RightBox rightBox = 
+	{
+		-(actor->size.x >> 1) - paddingHelper + centerDisplacement.x,
+		-(actor->size.y >> 1) - paddingHelper + centerDisplacement.y,
+		-(actor->size.z >> 1) - paddingHelper + centerDisplacement.z,
+
+		(actor->size.x >> 1) + paddingHelper + centerDisplacement.x,
+		(actor->size.y >> 1) + paddingHelper + centerDisplacement.y,
+		(actor->size.z >> 1) + paddingHelper + centerDisplacement.z
+	};
+
+	Stage::sweepRightBox(this, &rightBox);
+
+	return Actor::isInsideFrustrum(actor->transformation.position, rightBox);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Stage::sweepRightBox(RightBox* rightBox)
+{
+	if(0 < this->streamingLookAhead.x)
+	{
+		rightBox->x0 -= this->streamingLookAhead.x;
+	}
+	else
+	{
+		rightBox->x1 -= this->streamingLookAhead.x;
+	}
+
+	if(0 < this->streamingLookAhead.y)
+	{
+		rightBox->y0 -= this->streamingLookAhead.y;
+	}
+	else
+	{
+		rightBox->y1 -= this->streamingLookAhead.y;
+	}
+
+	if(0 < this->streamingLookAhead.z)
+	{
+		rightBox->z0 -= this->streamingLookAhead.z;
+	}
+	else
+	{
+		rightBox->z1 -= this->streamingLookAhead.z;
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+bool Stage::loadActor(StageActorDescription* stageActorDescription, int32 defer)
+{
+	if
+	(
+		!Stage::isActorInLoadRange
+		(
+			this, stageActorDescription->positionedActor->onScreenPosition, 
+			stageActorDescription->validRightBox ? 
+				&stageActorDescription->rightBox : NULL
+		)
+	)
+	{
+		return false;
+	}
+
+	uint16 framesToVisibility = Stage::computeFramesToVisibility(this, stageActorDescription);
+
+	// The actor should have been on screen already
+	if(0 == framesToVisibility)
+	{
+		this->lateSpawns++;
+	}
+
+	Stage::reviveUnloadedActor(this, stageActorDescription->positionedActor);
 
-		return Actor::isInsideFrustrum(Vector3D::getFromScreenPixelVector(onScreenPosition), helperRightBox);
+	stageActorDescription->internalId = this->nextActorId++;
+	stageActorDescription->loadFrame = this->streamingFrame;
+
+#ifdef __ENABLE_STREAMING_TELEMETRY
+	StreamingTelemetrySample startSample = StreamingTelemetry::startSample();
+#endif
+
+	if(defer)
+	{
+		ActorFactory::spawnActor
+		(
+			this->actorFactory, stageActorDescription->positionedActor, Container::safeCast(this), 
+			stageActorDescription->internalId, 
+			this->predictiveStreaming && __STREAMING_PREDICTION_URGENT_FRAMES > framesToVisibility
+		);
 	}
 	else
 	{
-		return Actor::isInsideFrustrum(Vector3D::getFromScreenPixelVector(onScreenPosition), *rightBox);
+		Stage::doAddChildActor
+		(
+			this, stageActorDescription->positionedActor, false, stageActorDescription->internalId
+		);
 	}
 
+#ifdef __ENABLE_STREAMING_TELEMETRY
+	StreamingTelemetry::record
+	(
+		kStreamingTelemetryLoad, this->streamingPhase, stageActorDescription->positionedActor, 
+		stageActorDescription->positionedActor->actorSpec, stageActorDescription->internalId, startSample
+	);
+#endif
+
 	return true;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+uint16 Stage::computeFramesToVisibility(StageActorDescription* stageActorDescription)
+{
+	extern const CameraFrustum* _cameraFrustum;
+
+	// Remove the padding baked in the bounding box
+	fixed_t padding = __PIXELS_TO_METERS(this->stageSpec->streaming.loadPadding);
+
+	RightBox rightBox = {0, 0, 0, 0, 0, 0};
+
+	if(stageActorDescription->validRightBox)
+	{
+		rightBox = stageActorDescription->rightBox;
+		rightBox.x0 += padding;
+		rightBox.x1 -= padding;
+		rightBox.y0 += padding;
+		rightBox.y1 -= padding;
+		rightBox.z0 += padding;
+		rightBox.z1 -= padding;
+	}
+
+	Vector3D position = 
+		Vector3D::rotate
+		(
+			Vector3D::getRelativeToCamera(Vector3D::getFromScreenPixelVector(stageActorDescription->positionedActor->onScreenPosition)), 
+			*_cameraInvertedRotation
+		);
+
+#ifndef __LEGACY_COORDINATE_PROJECTION
+	position.x += __PIXELS_TO_METERS(_cameraFrustum->x1 - _cameraFrustum->x0) >> 1;
+	position.y += __PIXELS_TO_METERS(_cameraFrustum->y1 - _cameraFrustum->y0) >> 1;
+	position.z += __PIXELS_TO_METERS(_cameraFrustum->z1 - _cameraFrustum->z0) >> 1;
+#endif
+
+	Vector3D speed = Vector3D::rotate(this->cameraVelocity, *_cameraInvertedRotation);
+
+	uint16 framesToOverlapX = 
+		Stage::computeFramesToOverlap
+		(
+			position.x + rightBox.x0, position.x + rightBox.x1, 
+			__PIXELS_TO_METERS(_cameraFrustum->x0), __PIXELS_TO_METERS(_cameraFrustum->x1), speed.x
+		);
+
+	uint16 framesToOverlapY = 
+		Stage::computeFramesToOverlap
+		(
+			position.y + rightBox.y0, position.y + rightBox.y1, 
+			__PIXELS_TO_METERS(_cameraFrustum->y0), __PIXELS_TO_METERS(_cameraFrustum->y1), speed.y
+		);
+
+	uint16 framesToOverlapZ = 
+		Stage::computeFramesToOverlap
+		(
+			position.z + rightBox.z0, position.z + rightBox.z1, 
+			__PIXELS_TO_METERS(_cameraFrustum->z0), __PIXELS_TO_METERS(_cameraFrustum->z1), speed.z
+		);
+
+	// The actor becomes visible once it overlaps the frustum along all the axes
+	return Math::max(framesToOverlapX, Math::max(framesToOverlapY, framesToOverlapZ));
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Stage::predictCameraMotion()
+{
+	Vector3D displacement = Camera::getLastDisplacement(Camera::getInstance());
+
+	// Smooth out the camera's jitter
+	this->cameraVelocity.x += (displacement.x - this->cameraVelocity.x) >> 2;
+	this->cameraVelocity.y += (displacement.y - this->cameraVelocity.y) >> 2;
+	this->cameraVelocity.z += (displacement.z - this->cameraVelocity.z) >> 2;
+
+	Vector3D lookAhead = Vector3D::rotate(this->cameraVelocity, *_cameraInvertedRotation);
+
+	fixed_t maximumLookAhead = __PIXELS_TO_METERS(__STREAMING_PREDICTION_MAXIMUM_LOOK_AHEAD);
+
+	this->streamingLookAhead.x = 
+		Math::max(-maximumLookAhead, Math::min(maximumLookAhead, lookAhead.x * __STREAMING_PREDICTION_FRAMES));
+	this->streamingLookAhead.y = 
+		Math::max(-maximumLookAhead, Math::min(maximumLookAhead, lookAhead.y * __STREAMING_PREDICTION_FRAMES));
+	this->streamingLookAhead.z = 
+		Math::max(-maximumLookAhead, Math::min(maximumLookAhead, lookAhead.z * __STREAMING_PREDICTION_FRAMES));
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 bool Stage::purgeActors(int32 defer __attribute__((unused)))
 {
+#ifdef __ENABLE_STREAMING_TELEMETRY
+	if(!this->pendingChildrenPurging || NULL == this->children)
+	{
+		return false;
+	}
+
+	StreamingTelemetrySample startSample = StreamingTelemetry::startSample();
+	uint16 purgedActors = 0;
+
+	// The actors are deleted in a single batch, so its cost is spread across them
+	for(VirtualNode node = this->children->head; NULL != node; node = node->next)
+	{
+		Actor actor = Actor::safeCast(node->data);
+
+		if(actor->deleteMe)
+		{
+			StreamingTelemetry::record
+			(
+				kStreamingTelemetryPurge, this->streamingPhase, NULL, Actor::getSpec(actor), actor->internalId, 
+				StreamingTelemetry::startSample()
+			);
+
+			purgedActors++;
+		}
+	}
+
+	bool purged = Stage::purgeChildren(this);
+
+	StreamingTelemetry::amortize(purgedActors, startSample);
+
+	return purged;
+#else
 	return this->pendingChildrenPurging && Stage::purgeChildren(this);
+#endif
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 bool Stage::updateActorFactory(int32 defer __attribute__((unused)))
 {	
+#ifdef __ENABLE_STREAMING_TELEMETRY
+	if(!ActorFactory::hasActorsPending(this->actorFactory))
+	{
+		return false;
+	}
+
+	StreamingTelemetrySample startSample = StreamingTelemetry::startSample();
+
+	bool createdActor = ActorFactory::createNextActor(this->actorFactory);
+
+	const PositionedActor* positionedActor = ActorFactory::getProcessedPositionedActor(this->actorFactory);
+
+	StreamingTelemetry::record
+	(
+		kStreamingTelemetryFactoryStep, this->streamingPhase, positionedActor, 
+		NULL != positionedActor ? positionedActor->actorSpec : NULL, -1, startSample
+	);
+
+	return createdActor;
+#else
 	return ActorFactory::hasActorsPending(this->actorFactory) && ActorFactory::createNextActor(this->actorFactory);
+#endif
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Stage::cacheUnloadedActor(const PositionedActor* positionedActor, Actor actor)
+{
+	StreamingChurn* streamingChurn = Stage::findStreamingChurn(this, Actor::getSpec(actor), true);
+
+	if(NULL != streamingChurn)
+	{
+		streamingChurn->unloads++;
+	}
+
+	RecentlyUnloadedActor* recentlyUnloadedActor = NULL;
+
+	for(VirtualNode node = this->recentlyUnloadedActors->head; NULL != node; node = node->next)
+	{
+		if(positionedActor == ((RecentlyUnloadedActor*)node->data)->positionedActor)
+		{
+			recentlyUnloadedActor = (RecentlyUnloadedActor*)node->data;
+
+			// Its tile sets are still held, just move it to the end of the queue
+			VirtualList::removeNode(this->recentlyUnloadedActors, node);
+			break;
+		}
+	}
+
+	if(NULL == recentlyUnloadedActor)
+	{
+		if(__STREAMING_RECENTLY_UNLOADED_ACTORS <= VirtualList::getCount(this->recentlyUnloadedActors))
+		{
+			Stage::releaseUnloadedActor(this, (RecentlyUnloadedActor*)VirtualList::popFront(this->recentlyUnloadedActors));
+		}
+
+		recentlyUnloadedActor = new RecentlyUnloadedActor;
+		recentlyUnloadedActor->positionedActor = positionedActor;
+
+		int16 heldTileSets = 0;
+		uint16 sprites = Actor::getComponentsCount(actor, kSpriteComponent);
+
+		for(int16 i = 0; i < sprites && __STREAMING_RECENTLY_UNLOADED_TILE_SETS > heldTileSets; i++)
+		{
+			Sprite sprite = Sprite::safeCast(Actor::getComponentAtIndex(actor, kSpriteComponent, i));
+
+			if(isDeleted(sprite))
+			{
+				continue;
+			}
+
+			Texture texture = Sprite::getTexture(sprite);
+
+			if(isDeleted(texture))
+			{
+				continue;
+			}
+
+			TileSet tileSet = Texture::getTileSet(texture, false);
+
+			// Only shared tile sets are picked up again by the next instance
+			if(isDeleted(tileSet) || !TileSet::isShared(tileSet))
+			{
+				continue;
+			}
+
+			TileSet::increaseUsageCount(tileSet);
+			recentlyUnloadedActor->tileSets[heldTileSets++] = tileSet;
+		}
+
+		for(; __STREAMING_RECENTLY_UNLOADED_TILE_SETS > heldTileSets; heldTileSets++)
+		{
+			recentlyUnloadedActor->tileSets[heldTileSets] = NULL;
+		}
+	}
+
+	recentlyUnloadedActor->unloadFrame = this->streamingFrame;
+
+	VirtualList::pushBack(this->recentlyUnloadedActors, recentlyUnloadedActor);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Stage::reviveUnloadedActor(const PositionedActor* positionedActor)
+{
+	for(VirtualNode node = this->recentlyUnloadedActors->head; NULL != node; node = node->next)
+	{
+		if(positionedActor == ((RecentlyUnloadedActor*)node->data)->positionedActor)
+		{
+			StreamingChurn* streamingChurn = Stage::findStreamingChurn(this, positionedActor->actorSpec, true);
+
+			if(NULL != streamingChurn)
+			{
+				streamingChurn->reloads++;
+			}
+
+			// The tile sets are released when the entry expires, by then the new instance
+			// has claimed them if it was created in time
+			break;
+		}
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Stage::expireUnloadedActors(bool all)
+{
+	if(isDeleted(this->recentlyUnloadedActors))
+	{
+		return;
+	}
+
+	// The queue is sorted by unload frame, so only its head can expire
+	while(NULL != this->recentlyUnloadedActors->head)
+	{
+		RecentlyUnloadedActor* recentlyUnloadedActor = (RecentlyUnloadedActor*)this->recentlyUnloadedActors->head->data;
+
+		if
+		(
+			!all 
+			&& 
+			__STREAMING_RECENTLY_UNLOADED_FRAMES > (uint16)(this->streamingFrame - recentlyUnloadedActor->unloadFrame)
+		)
+		{
+			break;
+		}
+
+		Stage::releaseUnloadedActor(this, (RecentlyUnloadedActor*)VirtualList::popFront(this->recentlyUnloadedActors));
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Stage::releaseUnloadedActor(RecentlyUnloadedActor* recentlyUnloadedActor)
+{
+	if(NULL == recentlyUnloadedActor)
+	{
+		return;
+	}
+
+	for(int16 i = 0; i < __STREAMING_RECENTLY_UNLOADED_TILE_SETS; i++)
+	{
+		if(!isDeleted(recentlyUnloadedActor->tileSets[i]))
+		{
+			TileSet::release(recentlyUnloadedActor->tileSets[i]);
+		}
+	}
+
+	delete recentlyUnloadedActor;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+StreamingChurn* Stage::findStreamingChurn(const ActorSpec* actorSpec, bool create)
+{
+	if(NULL == actorSpec || isDeleted(this->streamingChurn))
+	{
+		return NULL;
+	}
+
+	for(VirtualNode node = this->streamingChurn->head; NULL != node; node = node->next)
+	{
+		if(actorSpec == ((StreamingChurn*)node->data)->actorSpec)
+		{
+			return (StreamingChurn*)node->data;
+		}
+	}
+
+	if(!create)
+	{
+		return NULL;
+	}
+
+	StreamingChurn* streamingChurn = new StreamingChurn;
+	streamingChurn->actorSpec = actorSpec;
+	streamingChurn->unloads = 0;
+	streamingChurn->reloads = 0;
+
+	VirtualList::pushBack(this->streamingChurn, streamingChurn);
+
+	return streamingChurn;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -913,6 +1635,7 @@ StageActorDescription* Stage::registerActor(PositionedActor* positionedActor)
 
 	stageActorDescription->extraInfo = NULL;
 	stageActorDescription->internalId = -1;
+	stageActorDescription->loadFrame = 0;
 	stageActorDescription->positionedActor = positionedActor;
 
 	Vector3D environmentPosition = Vector3D::zero();
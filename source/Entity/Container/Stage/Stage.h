@@ -154,11 +154,29 @@ typedef struct StageActorDescription
 	/// ID to keep track internally of the actor
 	int16 internalId;
 
+	/// Stage's streaming frame when the actor was streamed in
+	uint16 loadFrame;
+
 	/// If false, the bounding box's volume is zero
 	bool validRightBox;
 
 } StageActorDescription;
 
+/// Streaming churn statistics of an actor spec
+/// @memberof Stage
+typedef struct StreamingChurn
+{
+	/// Spec of the actors
+	const ActorSpec* actorSpec;
+
+	/// Number of times that actors with this spec were streamed out
+	uint16 unloads;
+
+	/// Number of times that actors with this spec were streamed in again shortly after being streamed out
+	uint16 reloads;
+
+} StreamingChurn;
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DECLARATION
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -191,6 +209,12 @@ class Stage : Container
 	/// Index for streaming method to execute in the current game cycle
 	uint16 streamingPhase;
 
+	/// Consecutive streaming steps that found no work to do
+	uint8 idleStreamingPhases;
+
+	/// If true, each streaming phase stops after streaming a single actor
+	bool streamingInSteps;
+
 	/// Amount of actor descriptions to check for streaming in entitis
 	uint16 streamingAmplitude;
 
@@ -207,6 +231,34 @@ class Stage : Container
 	/// Cache of the camera's transformation for resuming the game
 	Transformation cameraTransformation;
 
+	/// Smoothed camera's displacement per game frame
+	Vector3D cameraVelocity;
+
+	/// Camera's displacement, relative to its orientation, predicted over the streaming's look ahead
+	Vector3D streamingLookAhead;
+
+	/// Number of actors that were spawned when they already were inside the camera's frustum
+	uint32 lateSpawns;
+
+	/// Actors recently streamed out whose shared tile sets are kept resident
+	VirtualList recentlyUnloadedActors;
+
+	/// Streaming churn statistics per actor spec
+	VirtualList streamingChurn;
+
+	/// Minimum distance, in pixels, between the ranges where actors are streamed in and out
+	uint16 hysteresisPadding;
+
+	/// Game frames that a streamed in actor stays loaded before it can be streamed out
+	uint16 minimumResidentFrames;
+
+	/// Game frames elapsed since the stage was created
+	uint16 streamingFrame;
+
+	/// If true, the streaming extrapolates the camera's motion to load actors ahead of it
+	/// and unload those behind it sooner
+	bool predictiveStreaming;
+
 	/// @publicsection
 
 	/// Class' constructor
@@ -219,6 +271,9 @@ class Stage : Container
 	/// Prepare to resume this instance's logic.
 	override void resume();
 
+	/// Update the stage's children.
+	override void update();
+
 	/// Retrieve the stage's spec.
 	/// @return Specification that determines how the stage was configured
 	const StageSpec* getSpec();
@@ -252,12 +307,44 @@ class Stage : Container
 	/// @param y: Screen y coordinate where to print
 	void print(int32 x, int32 y);
 
+	/// Enable or disable the predictive streaming.
+	/// @param predictiveStreaming: If true, the streaming extrapolates the camera's motion
+	void setPredictiveStreaming(bool predictiveStreaming);
+
+	/// Retrieve the number of actors that were spawned when they already were inside the camera's frustum.
+	/// @return Number of late spawns
+	uint32 getLateSpawns();
+
+	/// Retrieve the streaming phase that will run next.
+	/// @return Index of the next streaming phase
+	uint8 getStreamingPhase();
+
+	/// Configure the streaming's protection against loading and unloading the same actors repeatedly.
+	/// @param hysteresisPadding: Minimum distance, in pixels, between the ranges where actors are
+	/// streamed in and out
+	/// @param minimumResidentFrames: Game frames that a streamed in actor stays loaded before it can
+	/// be streamed out
+	void setStreamingHysteresis(uint16 hysteresisPadding, uint16 minimumResidentFrames);
+
+	/// Retrieve the streaming churn statistics of an actor spec.
+	/// @param actorSpec: Spec of the actors
+	/// @return Pointer to the statistics; NULL if no actor with the provided spec has been streamed out
+	const StreamingChurn* getStreamingChurn(const ActorSpec* actorSpec);
+
+	/// Release the shared tile sets kept resident for recently streamed out actors.
+	/// @return True if any tile set was released
+	bool reclaimTileSets();
+
 	/// Reset the streaming state so the new cycle starts anew.
 	virtual void resetStreaming();
 	
 	/// Stream in or out actors within or outside the camera's range.
 	virtual bool stream();
 
+	/// Run a single streaming phase that streams in or out one actor at most.
+	/// @return True if there may be streaming work pending; false otherwise
+	bool streamStep();
+
 	/// Configure the stage with the actors defined in its spec.
 	/// @param positionedActorsToIgnore: List of positioned actor structs to register for streaming
 	virtual void configure(VirtualList positionedActorsToIgnore);
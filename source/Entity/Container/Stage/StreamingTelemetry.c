@@ -0,0 +1,249 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+#ifdef __ENABLE_STREAMING_TELEMETRY
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <Communications.h>
+#include <DebugConfig.h>
+#include <Mem.h>
+#include <Printer.h>
+#include <StopwatchManager.h>
+#include <Timer.h>
+
+#include "StreamingTelemetry.h"
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' ATTRIBUTES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static StreamingTelemetryRecord _records[__STREAMING_TELEMETRY_RECORDS];
+static uint16 _head = 0;
+static uint16 _usedRecords = 0;
+static uint32 _droppedRecords = 0;
+static uint32 _frame = 0;
+static uint32 _frameTicks = 0;
+static uint32 _highestFrameTicks = 0;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PUBLIC STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void StreamingTelemetry::reset()
+{
+	Mem::clear((uint8*)_records, sizeof(_records));
+
+	_head = 0;
+	_usedRecords = 0;
+	_droppedRecords = 0;
+	_frame = 0;
+	_frameTicks = 0;
+	_highestFrameTicks = 0;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static StreamingTelemetrySample StreamingTelemetry::startSample()
+{
+	return (StreamingTelemetrySample)
+	{
+		StopwatchManager::getInterrupts(StopwatchManager::getInstance()),
+		Timer::getCurrentTimerCounter()
+	};
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void StreamingTelemetry::record
+(
+	uint8 event, uint8 phase, const PositionedActor* positionedActor, const ActorSpec* actorSpec,
+	int16 internalId, StreamingTelemetrySample startSample
+)
+{
+	uint16 ticks = StreamingTelemetry::computeElapsedTicks(startSample);
+
+	_frameTicks += ticks;
+
+	StreamingTelemetry::pushRecord(event, phase, positionedActor, actorSpec, internalId, ticks);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void StreamingTelemetry::amortize(uint16 records, StreamingTelemetrySample startSample)
+{
+	if(0 == records)
+	{
+		return;
+	}
+
+	if(_usedRecords < records)
+	{
+		records = _usedRecords;
+	}
+
+	uint16 ticks = StreamingTelemetry::computeElapsedTicks(startSample);
+	uint16 index = (_head + __STREAMING_TELEMETRY_RECORDS - records) % __STREAMING_TELEMETRY_RECORDS;
+
+	// The batch's cost already includes whatever was accounted to its records
+	for(uint16 i = 0; i < records; i++)
+	{
+		_frameTicks -= _records[(index + i) % __STREAMING_TELEMETRY_RECORDS].ticks;
+	}
+
+	_frameTicks += ticks;
+
+	// The first record takes the remainder so the batch's total cost is preserved
+	_records[index].ticks = ticks / records + ticks % records;
+
+	for(uint16 i = 1; i < records; i++)
+	{
+		_records[(index + i) % __STREAMING_TELEMETRY_RECORDS].ticks = ticks / records;
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void StreamingTelemetry::endFrame(uint8 phase)
+{
+	// Idle frames are not recorded to not flush the interesting ones out of the ring buffer
+	if(0 < _frameTicks)
+	{
+		if(_highestFrameTicks < _frameTicks)
+		{
+			_highestFrameTicks = _frameTicks;
+		}
+
+		StreamingTelemetry::pushRecord
+		(
+			kStreamingTelemetryFrameEnd, phase, NULL, NULL, -1, 0xFFFF < _frameTicks ? 0xFFFF : _frameTicks
+		);
+	}
+
+	_frameTicks = 0;
+	_frame++;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static bool StreamingTelemetry::dump()
+{
+	StreamingTelemetryHeader telemetryHeader =
+	{
+		__STREAMING_TELEMETRY_MAGIC,
+		Timer::getResolutionInUS(),
+		_usedRecords,
+		_droppedRecords,
+		_frame
+	};
+
+	if(!Communications::broadcastData((uint8*)&telemetryHeader, sizeof(StreamingTelemetryHeader)))
+	{
+		return false;
+	}
+
+	// The ring buffer is sent in two chunks so the records arrive sorted from oldest to newest
+	uint16 oldestRecord = __STREAMING_TELEMETRY_RECORDS > _usedRecords ? 0 : _head;
+	uint16 firstChunkRecords = _usedRecords - oldestRecord;
+
+	Communications::broadcastData((uint8*)&_records[oldestRecord], firstChunkRecords * sizeof(StreamingTelemetryRecord));
+
+	if(0 < oldestRecord)
+	{
+		Communications::broadcastData((uint8*)&_records[0], oldestRecord * sizeof(StreamingTelemetryRecord));
+	}
+
+	return true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void StreamingTelemetry::print(int32 x, int32 y)
+{
+	uint16 tickDurationUS = Timer::getResolutionInUS();
+
+	Printer::text("STREAMING TELEMETRY", x, y++, NULL);
+	y++;
+
+	Printer::text("Frames:       ", x, y, NULL);
+	Printer::int32(_frame, x + 14, y++, NULL);
+	Printer::text("Records:      ", x, y, NULL);
+	Printer::int32(_usedRecords, x + 14, y++, NULL);
+	Printer::text("Dropped:      ", x, y, NULL);
+	Printer::int32(_droppedRecords, x + 14, y++, NULL);
+	Printer::text("Worst (us):   ", x, y, NULL);
+	Printer::int32(_highestFrameTicks * tickDurationUS, x + 14, y++, NULL);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint16 StreamingTelemetry::computeElapsedTicks(StreamingTelemetrySample startSample)
+{
+	uint16 currentTimerCounter = Timer::getCurrentTimerCounter();
+	uint32 reloads = StopwatchManager::getInterrupts(StopwatchManager::getInstance()) - startSample.interrupts;
+
+	// The timer counts down and reloads upon reaching zero; a reload whose interrupt has not been
+	// serviced yet only shows as a counter higher than the starting one
+	if(0 == reloads && currentTimerCounter > startSample.timerCounter)
+	{
+		reloads = 1;
+	}
+
+	uint32 elapsedTicks = reloads * Timer::getTimerCounter() + startSample.timerCounter - currentTimerCounter;
+
+	// Records keep the ticks in 16 bits
+	return 0xFFFF < elapsedTicks ? 0xFFFF : elapsedTicks;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void StreamingTelemetry::pushRecord
+(
+	uint8 event, uint8 phase, const PositionedActor* positionedActor, const ActorSpec* actorSpec,
+	int16 internalId, uint16 ticks
+)
+{
+	StreamingTelemetryRecord* record = &_records[_head];
+
+	record->positionedActor = positionedActor;
+	record->actorSpec = actorSpec;
+	record->frame = _frame;
+	record->ticks = ticks;
+	record->internalId = internalId;
+	record->event = event;
+	record->phase = phase;
+
+	if(++_head >= __STREAMING_TELEMETRY_RECORDS)
+	{
+		_head = 0;
+	}
+
+	if(__STREAMING_TELEMETRY_RECORDS > _usedRecords)
+	{
+		_usedRecords++;
+	}
+	else
+	{
+		_droppedRecords++;
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#endif
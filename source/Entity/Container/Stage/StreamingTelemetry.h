@@ -0,0 +1,164 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+#ifndef STREAMING_TELEMETRY_H_
+#define STREAMING_TELEMETRY_H_
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <Actor.h>
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#ifndef __STREAMING_TELEMETRY_RECORDS
+#define __STREAMING_TELEMETRY_RECORDS				128
+#endif
+
+#define __STREAMING_TELEMETRY_MAGIC					0x54535556
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DATA
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Streaming events that can be recorded
+/// @memberof StreamingTelemetry
+enum StreamingTelemetryEvents
+{
+	kStreamingTelemetryLoad = 0,
+	kStreamingTelemetryUnload,
+	kStreamingTelemetryPurge,
+	kStreamingTelemetryFactoryStep,
+	kStreamingTelemetryFrameEnd,
+};
+
+/// Record of the telemetry's ring buffer
+/// @memberof StreamingTelemetry
+typedef struct StreamingTelemetryRecord
+{
+	/// Positioned actor involved in the event; NULL if unknown
+	const PositionedActor* positionedActor;
+
+	/// Spec of the actor involved in the event; NULL if unknown
+	const ActorSpec* actorSpec;
+
+	/// Game frame in which the event happened
+	uint32 frame;
+
+	/// Cost of the event in timer ticks; total streaming ticks of the game frame for frame ends
+	uint16 ticks;
+
+	/// Internal id of the actor involved in the event; -1 if unknown
+	int16 internalId;
+
+	/// Type of event (StreamingTelemetryEvents)
+	uint8 event;
+
+	/// Stage's streaming phase when the event was recorded
+	uint8 phase;
+
+	/// Padding
+	uint8 padding[2];
+
+} StreamingTelemetryRecord;
+
+/// Start of a timed streaming operation
+/// @memberof StreamingTelemetry
+typedef struct StreamingTelemetrySample
+{
+	/// Timer interrupts serviced when the operation started
+	uint32 interrupts;
+
+	/// Timer counter when the operation started
+	uint16 timerCounter;
+
+} StreamingTelemetrySample;
+
+/// Header preceding a dump of the telemetry's ring buffer
+/// @memberof StreamingTelemetry
+typedef struct StreamingTelemetryHeader
+{
+	/// Always __STREAMING_TELEMETRY_MAGIC
+	uint32 magic;
+
+	/// Microseconds per tick
+	uint16 tickDurationUS;
+
+	/// Number of records that follow the header
+	uint16 records;
+
+	/// Number of records overwritten before being dumped
+	uint32 droppedRecords;
+
+	/// Number of game frames closed since the last reset
+	uint32 frames;
+
+} StreamingTelemetryHeader;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DECLARATION
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Class StreamingTelemetry
+///
+/// Inherits from Object
+///
+/// Records which actors the stage loads, unloads and purges on each game frame, together with
+/// the cost of each operation in timer ticks and the streaming phase active at the end of the
+/// game frame. The records are kept in a ring buffer that can be dumped through the
+/// communications port for offline analysis (see lib/tools/analyzeStreamingTelemetry.sh).
+/// Only available if __ENABLE_STREAMING_TELEMETRY is defined.
+static class StreamingTelemetry : Object
+{
+	/// @publicsection
+
+	/// Discard all the records and reset the statistics.
+	static void reset();
+
+	/// Start timing a streaming operation.
+	/// @return Sample to pass to StreamingTelemetry::record
+	static StreamingTelemetrySample startSample();
+
+	/// Record a streaming operation.
+	/// @param event: Type of event (StreamingTelemetryEvents)
+	/// @param phase: Stage's current streaming phase
+	/// @param positionedActor: Positioned actor involved in the event; NULL if unknown
+	/// @param actorSpec: Spec of the actor involved in the event; NULL if unknown
+	/// @param internalId: Internal id of the actor involved in the event; -1 if unknown
+	/// @param startSample: Value returned by StreamingTelemetry::startSample when the operation started
+	static void record
+	(
+		uint8 event, uint8 phase, const PositionedActor* positionedActor, const ActorSpec* actorSpec,
+		int16 internalId, StreamingTelemetrySample startSample
+	);
+
+	/// Spread the cost of a batched operation evenly across the most recent records.
+	/// @param records: Number of most recent records that took part in the batch
+	/// @param startSample: Value returned by StreamingTelemetry::startSample when the batch started
+	static void amortize(uint16 records, StreamingTelemetrySample startSample);
+
+	/// Close the current game frame.
+	/// @param phase: Stage's streaming phase at the end of the game frame
+	static void endFrame(uint8 phase);
+
+	/// Send the records, oldest first, through the communications port preceded by a
+	/// StreamingTelemetryHeader.
+	/// @return True if the records were sent
+	static bool dump();
+
+	/// Print the telemetry's statistics.
+	/// @param x: Screen x coordinate where to print
+	/// @param y: Screen y coordinate where to print
+	static void print(int32 x, int32 y);
+}
+
+#endif
@@ -576,7 +576,12 @@ void Entity::setPosition(const Vector3D* position)
 {
 	this->transformation.position = *position;
 
-	if(!isDeleted(this->body) && Body::getPosition(this->body) != position)
+	if
+	(
+		!isDeleted(this->body) && Body::getPosition(this->body) != position 
+		&& 
+		Body::getInterpolatedPosition(this->body) != position
+	)
 	{
 		Body::setPosition(this->body, &this->transformation.position, Entity::safeCast(this));
 	}
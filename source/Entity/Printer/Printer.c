@@ -72,8 +72,7 @@ static void Printer::setDebugMode()
 	}
 
 	printer->mode = __PRINTING_MODE_DEBUG;
-	printer->lastUsedFontData = NULL;
-	printer->lastUsedFont = NULL;
+	Printer::invalidateFontCache();
 	Printer::loadDebugFont();
 	Printer::clear();
 }
@@ -149,8 +148,7 @@ static void Printer::releaseFonts()
 		_fontData[i].tileSet = NULL;
 	}
 
-	printer->lastUsedFont = NULL;
-	printer->lastUsedFontData = NULL;
+	Printer::invalidateFontCache();
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -163,6 +161,8 @@ static void Printer::clear()
 	{
 		PrintingSprite::clear(printer->activePrintingSprite);
 	}
+
+	Printer::invalidateShadow();
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -193,6 +193,130 @@ static void Printer::int32(int32 value, uint8 x, uint8 y, const char* font)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+static void Printer::printf(int32 x, int32 y, const char* font, const char* format, ...)
+{
+	char string[__PRINTER_PRINTF_BUFFER_SIZE];
+
+	va_list args;
+	va_start(args, format);
+
+	int32 i = 0;
+
+	for(; '\0' != *format && __PRINTER_PRINTF_BUFFER_SIZE - 1 > i; format++)
+	{
+		if('%' != *format)
+		{
+			string[i++] = *format;
+			continue;
+		}
+
+		format++;
+
+		bool zeroPadding = '0' == *format;
+		int32 width = 0;
+
+		for(; '0' <= *format && '9' >= *format; format++)
+		{
+			width = width * 10 + (*format - '0');
+		}
+
+		const char* argument = NULL;
+		char character[2] = {0, 0};
+		bool negative = false;
+
+		switch(*format)
+		{
+			case 'd':
+			case 'i':
+			{
+				int32 value = va_arg(args, int32);
+
+				negative = 0 > value;
+				argument = Utilities::itoa(negative ? -value : value, 10, 0);
+				break;
+			}
+
+			case 'u':
+			{
+				argument = Utilities::itoa(va_arg(args, uint32), 10, 0);
+				break;
+			}
+
+			case 'x':
+			case 'X':
+			{
+				argument = Utilities::itoa(va_arg(args, uint32), 16, 0);
+				break;
+			}
+
+			case 'c':
+			{
+				character[0] = (char)va_arg(args, int32);
+				argument = character;
+				break;
+			}
+
+			case 's':
+			{
+				argument = va_arg(args, const char*);
+				break;
+			}
+
+			case '%':
+			{
+				character[0] = '%';
+				argument = character;
+				break;
+			}
+
+			default:
+			{
+				// Unsupported conversion, print it verbatim
+				format--;
+				character[0] = '%';
+				argument = character;
+				break;
+			}
+		}
+
+		if(NULL == argument)
+		{
+			continue;
+		}
+
+		int32 length = strlen(argument) + (negative ? 1 : 0);
+
+		if(negative && zeroPadding && __PRINTER_PRINTF_BUFFER_SIZE - 1 > i)
+		{
+			string[i++] = '-';
+			negative = false;
+		}
+
+		for(; length < width && __PRINTER_PRINTF_BUFFER_SIZE - 1 > i; width--)
+		{
+			string[i++] = zeroPadding ? '0' : ' ';
+		}
+
+		if(negative && __PRINTER_PRINTF_BUFFER_SIZE - 1 > i)
+		{
+			string[i++] = '-';
+		}
+
+		for(; '\0' != *argument && __PRINTER_PRINTF_BUFFER_SIZE - 1 > i; argument++)
+		{
+			string[i++] = *argument;
+		}
+	}
+
+	string[i] = '\0';
+
+	va_end(args);
+
+	Printer::text(string, x, y, font);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 static void Printer::hex(uint32 value, uint8 x, uint8 y, uint8 length, const char* font)
 {
 	Printer::out(x, y, Utilities::itoa((int32)(value), 16, length), font);
@@ -385,6 +509,8 @@ static void Printer::addSprite()
 
 	Printer::clearComponentLists(printer, kSpriteComponent);
 
+	Printer::invalidateShadow();
+
 	Printer::fireEvent(printer, kEventFontRewritten);
 }
 
@@ -404,6 +530,9 @@ static bool Printer::setActiveSprite(uint16 printingSpriteIndex)
 		printer->activePrintingSprite = PrintingSprite::safeCast(Printer::getComponentAtIndex(printer, kSpriteComponent, 0));
 	}
 
+	// The shadow only mirrors a single printing area
+	Printer::invalidateShadow();
+
 	return result;
 }
 
@@ -507,6 +636,41 @@ static void Printer::setTransparency(uint8 transparency)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+static void Printer::setShadowing(bool shadowing __attribute__((unused)))
+{
+#ifdef __PRINTER_SHADOWING
+	Printer printer = Printer::getInstance();
+
+	if(shadowing && !printer->shadowing)
+	{
+		Printer::invalidateShadow();
+	}
+
+	printer->shadowing = shadowing;
+#endif
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint64 Printer::getDirtyRows(uint16* writtenCells)
+{
+	Printer printer = Printer::getInstance();
+
+	uint64 dirtyRows = printer->dirtyRows;
+
+	if(NULL != writtenCells)
+	{
+		*writtenCells = printer->writtenCells;
+	}
+
+	printer->dirtyRows = 0;
+	printer->writtenCells = 0;
+
+	return dirtyRows;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 static void Printer::setMask(uint16 mask)
 {
 	Printer printer = Printer::getInstance();
@@ -705,25 +869,7 @@ static void Printer::out(uint8 x, uint8 y, const char* string, const char* font)
 #endif
 
 	uint32 i = 0, position = 0, startColumn = x, xDisplacement = 0, yDisplacement = 0;
-	FontData* fontData = printer->lastUsedFontData;
-
-	if(NULL == fontData)
-	{
-		fontData = Printer::getFontByName(font);
-		printer->lastUsedFontData = fontData;
-		printer->lastUsedFont = font;
-	}
-	else if(printer->lastUsedFont != font && strcmp(fontData->fontSpec->name, font))
-	{
-		fontData = Printer::getFontByName(font);
-		printer->lastUsedFontData = fontData;
-		printer->lastUsedFont = font;
-	}
-	else
-	{
-		printer->lastUsedFontData = fontData;
-		printer->lastUsedFont = font;
-	}
+	FontData* fontData = Printer::resolveFont(font);
 
 	if(NULL == fontData || (__PRINTING_MODE_DEBUG != printer->mode && isDeleted(fontData->tileSet)))
 	{
@@ -827,25 +973,35 @@ static void Printer::out(uint8 x, uint8 y, const char* string, const char* font)
 						{
 							uint32 charOffset = charOffsetX + charOffsetY * tileLineSize;
 
-							*(offsetDisplacement + (charOffsetY << 6)) =
+							Printer::writeCell
+							(
+								printer,
+								offsetDisplacement + (charOffsetY << 6),
+								x + charOffsetX,
+								y + charOffsetY,
 								(
 									// Offset of tileSet in char memory + respective char of character
 									offset + stringEntryOffsetBySizeX + stringEntryOffsetBySizeY + charOffset								
 								)
-								| (printer->mask << 14);
+								| (printer->mask << 14)
+							);
 						}
 					}
 				}
 				else
 				{
-					uint16* offsetDisplacement = offsetDisplacementStart + position;
-
-					*(offsetDisplacement + (0 << 6)) =
+					Printer::writeCell
+					(
+						printer,
+						offsetDisplacementStart + position,
+						x,
+						y,
 						(
 							// Offset of tileSet in char memory + respective char of character
 							offset + (string[i] - fontOffsetCache)								
 						)
-						| (printer->mask << 14);					
+						| (printer->mask << 14)
+					);
 				}
 
 				x += xDisplacement;
@@ -870,6 +1026,111 @@ static void Printer::out(uint8 x, uint8 y, const char* string, const char* font)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+static FontData* Printer::resolveFont(const char* font)
+{
+	Printer printer = Printer::getInstance();
+
+	if(NULL != printer->lastUsedFontData && printer->lastUsedFont == font)
+	{
+		return printer->lastUsedFontData;
+	}
+
+	FontData* fontData = NULL;
+
+	// Font names are usually literals, so comparing the pointers avoids walking all the fonts
+	for(int16 i = 0; i < __PRINTER_FONT_CACHE_SIZE; i++)
+	{
+		if(NULL != printer->cachedFontData[i] && printer->cachedFontNames[i] == font)
+		{
+			fontData = printer->cachedFontData[i];
+			break;
+		}
+	}
+
+	if(NULL == fontData)
+	{
+		fontData = Printer::getFontByName(font);
+
+		if(NULL == fontData)
+		{
+			return NULL;
+		}
+
+		printer->cachedFontNames[printer->nextCachedFont] = font;
+		printer->cachedFontData[printer->nextCachedFont] = fontData;
+
+		if(__PRINTER_FONT_CACHE_SIZE <= ++printer->nextCachedFont)
+		{
+			printer->nextCachedFont = 0;
+		}
+	}
+
+	printer->lastUsedFont = font;
+	printer->lastUsedFontData = fontData;
+
+	return fontData;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Printer::invalidateFontCache()
+{
+	Printer printer = Printer::getInstance();
+
+	for(int16 i = 0; i < __PRINTER_FONT_CACHE_SIZE; i++)
+	{
+		printer->cachedFontNames[i] = NULL;
+		printer->cachedFontData[i] = NULL;
+	}
+
+	printer->nextCachedFont = 0;
+	printer->lastUsedFont = NULL;
+	printer->lastUsedFontData = NULL;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Printer::invalidateShadow()
+{
+#ifdef __PRINTER_SHADOWING
+	Printer printer = Printer::getInstance();
+
+	// No printed BGMap entry ever has bits 11 to 13 set, so this never matches a cell
+	for(int16 row = 0; row < __PRINTER_SHADOW_ROWS; row++)
+	{
+		for(int16 column = 0; column < __PRINTER_SHADOW_COLUMNS; column++)
+		{
+			printer->shadow[row][column] = 0xFFFF;
+		}
+	}
+#endif
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void Printer::writeCell(Printer printer, uint16* bgmapEntry, uint32 column, uint32 row, uint16 value)
+{
+#ifdef __PRINTER_SHADOWING
+	if(printer->shadowing && __PRINTER_SHADOW_COLUMNS > column && __PRINTER_SHADOW_ROWS > row)
+	{
+		if(printer->shadow[row][column] == value)
+		{
+			return;
+		}
+
+		printer->shadow[row][column] = value;
+	}
+#endif
+
+	*bgmapEntry = value;
+
+	// A BGMap has 64 rows, anything past them marks every row as dirty instead of shifting out of range
+	printer->dirtyRows |= (sizeof(printer->dirtyRows) << 3) > row ? ((uint64)0x01 << row) : ~(uint64)0;
+	printer->writtenCells++;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' PUBLIC METHODS
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -886,6 +1147,8 @@ bool Printer::onEvent(ListenerObject eventFirer, uint16 eventCode)
 
 			if(!isDeleted(tileSet))
 			{
+				// Every character printed with this font has to be rewritten
+				Printer::invalidateShadow();
 				TileSet::write(tileSet);
 				Printer::fireEvent(this, kEventFontRewritten);
 				NM_ASSERT(!isDeleted(this), "Printer::onEvent: deleted printer during kEventFontRewritten");
@@ -940,6 +1203,28 @@ void Printer::constructor()
 	this->lastUsedFont = NULL;
 	this->lastUsedFontData = NULL;
 	this->activePrintingSprite = NULL;
+	this->dirtyRows = 0;
+	this->writtenCells = 0;
+	this->nextCachedFont = 0;
+#ifdef __PRINTER_SHADOWING
+	this->shadowing = false;
+#endif
+
+	for(int16 i = 0; i < __PRINTER_FONT_CACHE_SIZE; i++)
+	{
+		this->cachedFontNames[i] = NULL;
+		this->cachedFontData[i] = NULL;
+	}
+
+#ifdef __PRINTER_SHADOWING
+	for(int16 row = 0; row < __PRINTER_SHADOW_ROWS; row++)
+	{
+		for(int16 column = 0; column < __PRINTER_SHADOW_COLUMNS; column++)
+		{
+			this->shadow[row][column] = 0xFFFF;
+		}
+	}
+#endif
 
 	for(int16 i = 0; NULL != _fontData[i].fontSpec; i++)
 	{
@@ -45,6 +45,22 @@ class PrintingSprite;
 #define __TAB_SIZE				  4
 #define __MAX_FONT_NAME_LENGTH	  16
 
+#ifndef __PRINTER_SHADOW_ROWS
+#define __PRINTER_SHADOW_ROWS	  28
+#endif
+
+#ifndef __PRINTER_SHADOW_COLUMNS
+#define __PRINTER_SHADOW_COLUMNS  48
+#endif
+
+#ifndef __PRINTER_FONT_CACHE_SIZE
+#define __PRINTER_FONT_CACHE_SIZE 4
+#endif
+
+#ifndef __PRINTER_PRINTF_BUFFER_SIZE
+#define __PRINTER_PRINTF_BUFFER_SIZE 64
+#endif
+
 #define __PRINTING_MODE_DEFAULT	  0
 #define __PRINTING_MODE_DEBUG	  1
 
@@ -181,6 +197,31 @@ singleton class Printer : Entity
 	/// Cache the last used font data to speed up searches
 	FontData* lastUsedFontData;
 
+	/// Names of the fonts already resolved to font data
+	const char* cachedFontNames[__PRINTER_FONT_CACHE_SIZE];
+
+	/// Font data resolved for each cached font name
+	FontData* cachedFontData[__PRINTER_FONT_CACHE_SIZE];
+
+#ifdef __PRINTER_SHADOWING
+	/// Copy of the BGMap entries written to the printing area
+	uint16 shadow[__PRINTER_SHADOW_ROWS][__PRINTER_SHADOW_COLUMNS];
+#endif
+
+	/// Bitmask of the rows written since the last call to getDirtyRows, one bit per BGMap row
+	uint64 dirtyRows;
+
+	/// Number of BGMap entries written since the last call to getDirtyRows
+	uint16 writtenCells;
+
+	/// Index of the next font cache entry to replace
+	uint8 nextCachedFont;
+
+#ifdef __PRINTER_SHADOWING
+	/// If true, only the cells whose BGMap entry changed are written
+	bool shadowing;
+#endif
+
 	/// Printer mode (Default or Debug)
 	uint8 mode;
 
@@ -226,6 +267,14 @@ singleton class Printer : Entity
 	/// @param font: Name of font to use for printing
 	static void int32(int32 value, uint8 x, uint8 y, const char* font);
 
+	/// Print a formatted string. The string is formatted into a buffer before writing it, 
+	/// supports %d, %i, %u, %x, %X, %c, %s and %% with optional zero padding and width.
+	/// @param x: Column to start printing at
+	/// @param y: Row to start printing at
+	/// @param font: Name of font to use for printing
+	/// @param format: Format string
+	static void printf(int32 x, int32 y, const char* font, const char* format, ...);
+
 	/// Print a hex value.
 	/// @param value: Hex value to print
 	/// @param x: Column to start printing at
@@ -296,6 +345,18 @@ singleton class Printer : Entity
 	/// @param transparency: Transparent value (__TRANSPARENCY_NONE, _EVEN or _ODD)
 	static void setTransparency(uint8 transparency);
 
+	/// Enable or disable the shadowing of the printing area. When enabled, only the
+	/// characters that differ from what is already on the printing area are written.
+	/// Only available if __PRINTER_SHADOWING is defined, since the shadow takes
+	/// __PRINTER_SHADOW_ROWS * __PRINTER_SHADOW_COLUMNS * 2 bytes of RAM.
+	/// @param shadowing: If true, the printing area is shadowed
+	static void setShadowing(bool shadowing);
+
+	/// Retrieve the rows written since the last call and reset the tracking.
+	/// @param writtenCells: Pointer to store the number of written BGMap entries (can be NULL)
+	/// @return Bitmask of the written rows, one bit per BGMap row
+	static uint64 getDirtyRows(uint16* writtenCells);
+
 	/// Set the mask to apply to the printing.
 	/// @param mask: Mask to apply to the printed binary data
 	static void setMask(uint16 mask);
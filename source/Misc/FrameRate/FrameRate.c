@@ -76,6 +76,20 @@ uint32 FrameRate::getAverageFPS()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+uint16 FrameRate::getFPS()
+{
+	return this->FPS;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+uint16 FrameRate::getUnevenFPS()
+{
+	return this->unevenFPS;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void FrameRate::update()
 {
 	this->FPS++;
@@ -67,6 +67,14 @@ singleton class FrameRate : ListenerObject
 	/// @return Average frames per second
 	uint32 getAverageFPS();
 
+	/// Retrieve the game frames completed during the current second.
+	/// @return Completed game frames during the current second
+	uint16 getFPS();
+
+	/// Retrieve the game frames that started before the previous one was completed during the current second.
+	/// @return Uneven game frames during the current second
+	uint16 getUnevenFPS();
+
 	/// Update the elapsed frames during the current second.
 	void update();
 
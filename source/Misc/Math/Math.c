@@ -21,6 +21,11 @@
 
 extern float sqrtf (float);
 
+#ifdef __DEBUG
+extern double sqrt (double);
+extern double atan2 (double, double);
+#endif
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' ATTRIBUTES
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -96,12 +101,30 @@ const int16 _sinLut[] =
  -50,  -43,  -37,  -31,  -25,  -18,  -12,   -6  //64
 };
 
+// Angle of the first octant whose tangent is index / 64
+static const uint8 _arcTangentLut[] =
+{
+   0,    1,    3,    4,    5,    6,    8,    9, //1
+  10,   11,   13,   14,   15,   16,   18,   19, //2
+  20,   21,   22,   24,   25,   26,   27,   28, //3
+  29,   30,   31,   33,   34,   35,   36,   37, //4
+  38,   39,   40,   41,   42,   43,   44,   45, //5
+  46,   46,   47,   48,   49,   50,   51,   52, //6
+  52,   53,   54,   55,   56,   56,   57,   58, //7
+  59,   59,   60,   61,   61,   62,   63,   63, //8
+  64
+};
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' MACROS
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 #define __ENTRIES_PER_QUADRANT	(__SIN_LUT_ENTRIES >> 2)
 #define __TOTAL_ENTRIES 		(__SIN_LUT_ENTRIES)
+#define __ENTRIES_PER_OCTANT	(__SIN_LUT_ENTRIES >> 3)
+
+// The arc tangent LUT has __ENTRIES_PER_OCTANT + 1 entries
+#define __ARC_TANGENT_LUT_ENTRIES_2_POWER	(6)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' PUBLIC STATIC METHODS
@@ -139,180 +162,170 @@ static fixed_ext_t Math::fixed_extInfinity()
 
 static int32 Math::aSin(fix7_9 sin)
 {
-	int32 angle = 0;
-	int32 entry = 0;
-	int32 lastEntry = __ENTRIES_PER_QUADRANT;
-	int32 difference = 1024;
+	if(0 >= sin)
+	{
+		return 0;
+	}
 
-	for(; entry < lastEntry; entry++)
+	if(__I_TO_FIX7_9(1) <= sin)
 	{
-		if(__ABS(sin - _sinLut[entry]) <= difference)
-		{
-			difference = __ABS(sin - _sinLut[entry]);
-			angle = entry;
-		}
-		else if(__ABS(sin - _sinLut[entry]) > difference)
-		{
-			break;
-		}
+		return __ENTRIES_PER_QUADRANT;
 	}
 
-	return angle;
+	// cos = sqrt(1 - sin^2), both in fix7_9
+	fix7_9 cos = (fix7_9)Math::squareRootInteger((uint32)(__I_TO_FIX7_9_EXT(1) * __I_TO_FIX7_9_EXT(1) - (int32)sin * sin), 0);
+
+	return Math::arcTangent2(sin, cos);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 static int32 Math::getAngle(fix7_9 cos, fix7_9 sin)
 {
-	int16 firstEntry = 0;
-	int32 lastEntry = 0;
-	bool ascendent = false;
+	return Math::arcTangent2(sin, cos);
+}
 
-	// Determine the quadrant
-	if(0 == cos)
-	{
-		// First quadrant
-		if(0 < sin)
-		{
-			return __ENTRIES_PER_QUADRANT * 1;
-		}
-		// Fourth quadrant
-		else if(0 > sin)
-		{
-			return __ENTRIES_PER_QUADRANT * 3;
-		}
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-		return 0;
-	}
-	else if(0 == sin)
+static int32 Math::arcTangent2(int32 y, int32 x)
+{
+	if(0 == x && 0 == y)
 	{
-		// First quadrant
-		if(0 < cos)
-		{
-			return __ENTRIES_PER_QUADRANT * 0;
-		}
-		// Fourth quadrant
-		else if(0 > cos)
-		{
-			return __ENTRIES_PER_QUADRANT * 2;
-		}
-
 		return 0;
 	}
-	else if(0 < cos)
-	{
-		// First quadrant
-		if(0 < sin)
-		{
-			firstEntry = 0;
-			lastEntry = __ENTRIES_PER_QUADRANT;
-		}
-		// Fourth quadrant
-		else
-		{
-			firstEntry = __ENTRIES_PER_QUADRANT * 3;
-			lastEntry = __TOTAL_ENTRIES;
-		}
 
-		ascendent = true;
+	uint32 absoluteX = 0 > x ? -(uint32)x : (uint32)x;
+	uint32 absoluteY = 0 > y ? -(uint32)y : (uint32)y;
+	int32 angle = 0;
+
+	// Scale both coordinates down alike until shifting them by the LUT's size cannot overflow
+	while(0 != ((absoluteX | absoluteY) >> (31 - __ARC_TANGENT_LUT_ENTRIES_2_POWER)))
+	{
+		absoluteX >>= 1;
+		absoluteY >>= 1;
 	}
-	// Second quadrant
-	else if(0 < sin)
+
+	// Fold the angle into the first octant, where the tangent lies between 0 and 1, and round
+	// the LUT index to the nearest entry
+	if(absoluteX >= absoluteY)
 	{
-		firstEntry = __ENTRIES_PER_QUADRANT;
-		lastEntry = firstEntry + __ENTRIES_PER_QUADRANT;
+		angle = _arcTangentLut[((absoluteY << __ARC_TANGENT_LUT_ENTRIES_2_POWER) + (absoluteX >> 1)) / absoluteX];
 	}
-	// Third quadrant
 	else
 	{
-		firstEntry = __ENTRIES_PER_QUADRANT * 2;
-		lastEntry = __TOTAL_ENTRIES - __ENTRIES_PER_QUADRANT;
+		angle = __ENTRIES_PER_QUADRANT - _arcTangentLut[((absoluteX << __ARC_TANGENT_LUT_ENTRIES_2_POWER) + (absoluteY >> 1)) / absoluteY];
 	}
 
-	int16 pivotEntry = firstEntry + (__ENTRIES_PER_QUADRANT >> 1);
-	int16 angle = pivotEntry;
-	int16 distance = 1024;
+	// Unfold it into the right quadrant
+	if(0 > x)
+	{
+		angle = (__ENTRIES_PER_QUADRANT << 1) - angle;
+	}
 
-	while(true)
+	if(0 > y)
 	{
-		int16 difference = ascendent ? sin - _sinLut[pivotEntry] : _sinLut[pivotEntry] - sin;
+		angle = __TOTAL_ENTRIES - angle;
+	}
 
-		if(distance > __ABS(difference))
-		{
-			distance = __ABS(difference);
-		}
-		else
-		{
-			break;
-		}
+	return __MODULO(angle, __TOTAL_ENTRIES);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static int32 Math::power(int32 base, int32 power)
+{
+	int32 result = 1;
 
-		angle = pivotEntry;
+	// Negative powers are treated as positive ones
+	power = 0 > power ? -power : power;
 
-		if(0 < difference)
+	// Exponentiation by squaring
+	while(0 != power)
+	{
+		if(power & 1)
 		{
-			firstEntry = pivotEntry;
-			pivotEntry = lastEntry - ((lastEntry - pivotEntry) >> 1);
+			result *= base;
 		}
-		else if(0 > difference)
+
+		power >>= 1;
+
+		if(0 != power)
 		{
-			lastEntry = pivotEntry;
-			pivotEntry = firstEntry + ((pivotEntry - firstEntry) >> 1);
+			base *= base;
 		}
 	}
 
-	return angle;
+	return result;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-static int32 Math::power(int32 base, int32 power)
+static int32 Math::powerFast(int32 base, int32 power)
 {
-	return 0 == power ? 1 : 1 == power ? base : Math::doPower(base, base, 0 > power ? -power : power);
+	return Math::power(base, power);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-static int32 Math::powerFast(int32 base, int32 power)
+#ifdef __DEBUG
+static void Math::checkErrorBounds()
 {
-	int32 i=0;
-	int32 j=0;
-	int32 sum = base;
-	int32 result = 0;
-	int32 limit = base;
-
-	power = 0 > power ? -power : power;
+	uint32 seed = 0x1F2E3D4C;
 
-	for(i = 1; i < power; i++)
+	for(int16 i = 0; i < 512; i++)
 	{
-		for(j = 0; j < limit; j++)
+		seed = seed * 1103515245 + 12345;
+		uint32 radicand = seed >> (seed & 31);
+
+		// The rounded square root r of X satisfies (2r - 1)^2 <= 4X <= (2r + 1)^2
+		for(uint16 fractionalBits = 0; fractionalBits <= 16; fractionalBits++)
 		{
-			result += sum;
-		}
-		limit = base -1;
-		sum = result;
-	}
+			if((fractionalBits & 1) && 0 != (radicand >> 31))
+			{
+				continue;
+			}
 
-	return 0 == power ? 1 : 1 == power ? base : result;
-}
+			uint64 x = ((uint64)radicand << fractionalBits) << 2;
+			uint64 root = Math::squareRootInteger(radicand, fractionalBits);
+			uint64 low = 0 == root ? 0 : ((root << 1) - 1) * ((root << 1) - 1);
+			uint64 high = ((root << 1) + 1) * ((root << 1) + 1);
 
-//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+			ASSERT(low <= x && x <= high, "Math::checkErrorBounds: squareRootInteger out of bounds");
+		}
 
-//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
-// CLASS' PRIVATE METHODS
-//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+		fixed_ext_t fixedRadicand = (fixed_ext_t)(radicand >> 1);
 
-//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+		if(0 < fixedRadicand)
+		{
+			uint32 root = Math::squareRootInteger((uint32)fixedRadicand, __FIXED_TO_I_BITS);
+			uint32 inverseRoot = Math::inverseSquareRootFixed(fixedRadicand, 16);
+			double exact = 65536.0 / sqrt((double)fixedRadicand / (1 << __FIXED_TO_I_BITS));
+			double error = (double)inverseRoot - exact;
+
+			ASSERT
+			(
+				0 == root || (0 > error ? -error : error) <= 0.5 + (double)inverseRoot / ((root << 1) - 1) + 1e-6, 
+				"Math::checkErrorBounds: inverseSquareRootFixed out of bounds"
+			);
+		}
 
-static int32 Math::multiply(int32 a, int32 b)
-{
-	return (0 < b) ? a + Math::multiply(a, b - 1) : 0;
-}
+		seed = seed * 1103515245 + 12345;
+		int32 x = (int32)seed >> (seed & 31);
+		seed = seed * 1103515245 + 12345;
+		int32 y = (int32)seed >> (seed & 31);
 
-//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+		if(0 != x || 0 != y)
+		{
+			double error = 
+				Math::arcTangent2(y, x) - atan2((double)y, (double)x) * __TOTAL_ENTRIES / (2 * 3.14159265358979);
 
-static int32 Math::doPower(int32 sum, int32 base, int32 power)
-{
-	return (1 < power) ? Math::doPower(Math::multiply(sum, base), base, power - 1) : sum;
+			for(; (__TOTAL_ENTRIES >> 1) < error; error -= __TOTAL_ENTRIES);
+			for(; -(__TOTAL_ENTRIES >> 1) > error; error += __TOTAL_ENTRIES);
+
+			ASSERT((0 > error ? -error : error) <= 1.2, "Math::checkErrorBounds: arcTangent2 out of bounds");
+		}
+	}
 }
+#endif
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
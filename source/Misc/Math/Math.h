@@ -350,11 +350,26 @@ static class Math : Object
 	/// @return The square root of the provided number
 	static inline float squareRoot(float radicand);
 
-	/// Compute the square root of the provided number (alrogithm takem from the DOOM's engine).
+	/// Compute the square root of the provided unsigned fixed point number digit by digit, without
+	/// floating point operations.
+	/// @param radicand: Number to compute the square root of
+	/// @param fractionalBits: Number of fractional bits of both the radicand and the result (up to 16)
+	/// @return The square root of the provided number rounded to the nearest value
+	static inline uint32 squareRootInteger(uint32 radicand, uint16 fractionalBits);
+
+	/// Compute the square root of the provided number.
 	/// @param radicand: Number to compute the square root of
 	/// @return The square root of the provided number
 	static inline fixed_t squareRootFixed(fixed_ext_t radicand);
 
+	/// Compute the reciprocal of the square root of the provided number. The square root is rounded
+	/// to the nearest fixed point value r before dividing, so the result is off from the exact value 
+	/// by at most 1/2 + result / (2 * r - 1) units in its last place.
+	/// @param radicand: Number to compute the reciprocal square root of
+	/// @param fractionalBits: Number of fractional bits of the result (up to 31 - __FIXED_TO_I_BITS)
+	/// @return The reciprocal of the square root of the provided number; __FIXED_EXT_INFINITY if it is not positive
+	static inline uint32 inverseSquareRootFixed(fixed_ext_t radicand, uint16 fractionalBits);
+
 	/// Retrieve a random seed (algorithm taken from https://www.youtube.com/watch?v=RzEjqJHW-NU).
 	/// @return Random seed
 	static inline uint32 randomSeed();
@@ -393,7 +408,7 @@ static class Math : Object
 
 	/// Compute the arc sin of the provided sin.
 	/// @param sin: sin value
-	/// @return Arcsin of the provided sin value
+	/// @return Arcsin of the provided sin value in the first quadrant (0-128)
 	static int32 aSin(fix7_9 sin);
 
 	/// Compute the angle between (0, 0) and (x, y).
@@ -402,6 +417,14 @@ static class Math : Object
 	/// @return Angle in degrees (0-512)
 	static int32 getAngle(fix7_9 x, fix7_9 y);
 
+	/// Compute the angle between (0, 0) and (x, y) for coordinates of any magnitude; the result is
+	/// within 1.2 units of the exact angle: half a unit from rounding the LUT entries and 1/128 radians
+	/// from rounding the tangent to the LUT index.
+	/// @param y: Y coordinate
+	/// @param x: X coordinate
+	/// @return Angle in degrees (0-512)
+	static int32 arcTangent2(int32 y, int32 x);
+
 	/// Compute the power for the provided base.
 	/// @param base: Base
 	/// @param power: Power
@@ -413,6 +436,10 @@ static class Math : Object
 	/// @param power: Power
 	/// @return Base elevated to the provided power
 	static int32 powerFast(int32 base, int32 power);
+
+	/// Check that squareRootInteger, inverseSquareRootFixed and arcTangent2 stay within their
+	/// documented error bounds over a sample of inputs. Only available in debug builds.
+	static void checkErrorBounds();
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -467,30 +494,68 @@ static inline float Math::squareRoot(float radicand)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+static inline uint32 Math::squareRootInteger(uint32 radicand, uint16 fractionalBits)
+{
+	uint32 remainder = 0;
+	uint32 root = 0;
+
+	// sqrt(radicand / 2^f) * 2^f == sqrt(radicand * 2^f), and the digits are consumed in pairs,
+	// so an odd number of fractional bits is evened out by shifting the radicand once
+	if(fractionalBits & 1)
+	{
+		radicand <<= 1;
+		fractionalBits--;
+	}
+
+	for(int16 pairs = 16 + (fractionalBits >> 1); 0 < pairs; pairs--)
+	{
+		remainder = (remainder << 2) | (radicand >> 30);
+		radicand <<= 2;
+		root <<= 1;
+
+		uint32 testDivisor = (root << 1) + 1;
+
+		if(remainder >= testDivisor)
+		{
+			remainder -= testDivisor;
+			root++;
+		}
+	}
+
+	// (root + 0.5)^2 = root^2 + root + 0.25
+	return remainder > root ? root + 1 : root;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 static inline fixed_t Math::squareRootFixed(fixed_ext_t radicand)
 {
-// Disable "warning: dereferencing type-punned pointer will break strict-aliasing rules"
-// Doom's code causes a warning because of breaking of aliasing rules
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+	if(0 >= radicand)
+	{
+		return 0;
+	}
 
-	float radicandHelper = (float)radicand;
+	return (fixed_t)Math::squareRootInteger((uint32)radicand, __FIXED_TO_I_BITS);
+}
 
-	float x = radicandHelper * 0.5F;
-	float y = radicandHelper;
-	long i = *(long*)&y;
-	i = 0x5f3759df - (i >> 1);
-	y = *(float*)&i;
-	y = y * (1.5F - ( x * y * y ));
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-#if __FIXED_POINT_TYPE == 13
-	return (fixed_t)(90.6f * radicandHelper * y );
-#else 
-#if __FIXED_POINT_TYPE == 6
-	return (fixed_t)(8 * radicandHelper * y);
-#else
-	return (fixed_t)__F_TO_FIXED(radicandHelper * y);
-#endif
-#endif
+static inline uint32 Math::inverseSquareRootFixed(fixed_ext_t radicand, uint16 fractionalBits)
+{
+	if(0 >= radicand)
+	{
+		return __FIXED_EXT_INFINITY;
+	}
+
+	uint32 root = Math::squareRootInteger((uint32)radicand, __FIXED_TO_I_BITS);
+
+	if(0 == root)
+	{
+		return __FIXED_EXT_INFINITY;
+	}
+
+	// 1 / (root / 2^f) = 2^(f + b) / root with b fractional bits, rounded to the nearest value
+	return ((1 << (__FIXED_TO_I_BITS + fractionalBits)) + (root >> 1)) / root;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -247,6 +247,12 @@ static class Vector3D : Object
 	/// @return True if p lies in ab; false otherwise
 	static inline bool isVectorInsideLine(Vector3D p, Vector3D a, Vector3D b);
 
+	/// Test if the provided right box lies inside the camera's frustum.
+	/// @param vector: RightBox's translation vector
+	/// @param rightBox: RightBox to test
+	/// @return True if any part of the right box lies inside the camera's frustum; false otherwise
+	static inline bool isInsideFrustrum(Vector3D vector, RightBox rightBox);
+
 	/// Print the vector's components.
 	/// @param vector: Vector to print
 	/// @param x: Screen x coordinate where to print
@@ -293,7 +299,28 @@ static inline Vector3D Vector3D::unit(uint16 axis)
 
 static inline Vector3D Vector3D::normalize(Vector3D vector)
 {
-	return Vector3D::scalarDivision(vector, Vector3D::length(vector));
+	fixed_ext_t squareLength = Vector3D::squareLength(vector);
+
+	if(0 >= squareLength)
+	{
+		return Vector3D::zero();
+	}
+
+	// The length's reciprocal with 16 fractional bits; since no component is longer than the 
+	// vector, the products stay below 2^(__FIXED_TO_I_BITS + 17)
+	int32 scale = (int32)Math_inverseSquareRootFixed(squareLength, 16);
+
+	if(__FIXED_EXT_INFINITY == scale)
+	{
+		return Vector3D::zero();
+	}
+
+	return (Vector3D)
+	{
+		(fixed_t)(((int32)vector.x * scale) >> 16),
+		(fixed_t)(((int32)vector.y * scale) >> 16),
+		(fixed_t)(((int32)vector.z * scale) >> 16)
+	};
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -828,4 +855,58 @@ static inline bool Vector3D::isVectorInsideLine(Vector3D vector, Vector3D a, Vec
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+static inline bool Vector3D::isInsideFrustrum(Vector3D vector, RightBox rightBox)
+{
+	vector = Vector3D::rotate(Vector3D::getRelativeToCamera(vector), *_cameraInvertedRotation);
+
+#ifndef __LEGACY_COORDINATE_PROJECTION
+	vector = 
+		Vector3D::sum
+		(
+			vector, 
+			(Vector3D)
+			{
+				__PIXELS_TO_METERS(_cameraFrustum->x1 - _cameraFrustum->x0) >> 1,
+				__PIXELS_TO_METERS(_cameraFrustum->y1 - _cameraFrustum->y0) >> 1,
+				__PIXELS_TO_METERS(_cameraFrustum->z1 - _cameraFrustum->z0) >> 1,
+			}
+		);
+#endif
+
+	if
+	(
+		vector.x + rightBox.x0 > __PIXELS_TO_METERS(_cameraFrustum->x1) 
+		||
+		vector.x + rightBox.x1 < __PIXELS_TO_METERS(_cameraFrustum->x0)
+	)
+	{
+		return false;
+	}
+
+	// Check y visibility
+	if
+	(
+		vector.y + rightBox.y0 > __PIXELS_TO_METERS(_cameraFrustum->y1) 
+		||
+		vector.y + rightBox.y1 < __PIXELS_TO_METERS(_cameraFrustum->y0)
+	)
+	{
+		return false;
+	}
+
+	// Check z visibility
+	if
+	(
+		vector.z + rightBox.z0 > __PIXELS_TO_METERS(_cameraFrustum->z1)
+		||
+		vector.z + rightBox.z1 < __PIXELS_TO_METERS(_cameraFrustum->z0))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 #endif
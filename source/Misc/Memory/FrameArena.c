@@ -0,0 +1,149 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <DebugConfig.h>
+#include <Hardware.h>
+#include <Printer.h>
+
+#include "FrameArena.h"
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Each block is preceded by the game frame in which it was allocated in non release builds
+#ifndef __RELEASE
+#define __FRAME_ARENA_BLOCK_HEADER_SIZE				sizeof(uint32)
+#else
+#define __FRAME_ARENA_BLOCK_HEADER_SIZE				0
+#endif
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' ATTRIBUTES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint32 _buffer[__FRAME_ARENA_SIZE / sizeof(uint32)];
+static uint32 _usedBytes = 0;
+static uint32 _peakUsedBytes = 0;
+static uint32 _overflows = 0;
+
+#ifndef __RELEASE
+static uint32 _frame = 0;
+#endif
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PUBLIC STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void* FrameArena::allocate(uint32 numberOfBytes)
+{
+	// Keep the blocks word aligned
+	uint32 blockSize = (numberOfBytes + __FRAME_ARENA_BLOCK_HEADER_SIZE + sizeof(uint32) - 1) & ~(sizeof(uint32) - 1);
+
+	Hardware::suspendInterrupts();
+
+	if(__FRAME_ARENA_SIZE < _usedBytes + blockSize)
+	{
+		_overflows++;
+
+		Hardware::resumeInterrupts();
+		return NULL;
+	}
+
+	uint8* block = (uint8*)_buffer + _usedBytes;
+
+	_usedBytes += blockSize;
+
+	if(_peakUsedBytes < _usedBytes)
+	{
+		_peakUsedBytes = _usedBytes;
+	}
+
+#ifndef __RELEASE
+	*(uint32*)block = _frame;
+#endif
+
+	Hardware::resumeInterrupts();
+
+	return block + __FRAME_ARENA_BLOCK_HEADER_SIZE;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void FrameArena::reset()
+{
+#ifndef __RELEASE
+	// Poison the released blocks so pointers that escaped the frame are easy to spot
+	for(uint32 i = 0; i < (_usedBytes >> 2); i++)
+	{
+		_buffer[i] = __FRAME_ARENA_POISON;
+	}
+
+	_frame++;
+#endif
+
+	_usedBytes = 0;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static bool FrameArena::contains(const void* pointer)
+{
+	return (const uint8*)_buffer <= (const uint8*)pointer && (const uint8*)pointer < (const uint8*)_buffer + __FRAME_ARENA_SIZE;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static bool FrameArena::isValid(const void* pointer)
+{
+	const uint8* block = (const uint8*)pointer - __FRAME_ARENA_BLOCK_HEADER_SIZE;
+
+	if((const uint8*)_buffer > block || (const uint8*)_buffer + _usedBytes <= block)
+	{
+		return false;
+	}
+
+#ifndef __RELEASE
+	return _frame == *(const uint32*)block;
+#else
+	return true;
+#endif
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint32 FrameArena::getUsedBytes()
+{
+	return _usedBytes;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void FrameArena::print(int32 x, int32 y)
+{
+	Printer::text("FRAME ARENA", x, y++, NULL);
+	y++;
+
+	Printer::text("Size:", x, y, NULL);
+	Printer::int32(__FRAME_ARENA_SIZE, x + 12, y++, NULL);
+	Printer::text("Used:         ", x, y, NULL);
+	Printer::int32(_usedBytes, x + 12, y++, NULL);
+	Printer::text("Peak:         ", x, y, NULL);
+	Printer::int32(_peakUsedBytes, x + 12, y++, NULL);
+	Printer::text("Overflows:    ", x, y, NULL);
+	Printer::int32(_overflows, x + 12, y++, NULL);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -0,0 +1,75 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+#ifndef FRAME_ARENA_H_
+#define FRAME_ARENA_H_
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <Object.h>
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#ifndef __FRAME_ARENA_SIZE
+#define __FRAME_ARENA_SIZE							1024
+#endif
+
+/// Value written over the arena's memory when it is reset in non release builds
+#define __FRAME_ARENA_POISON						0xFAFAFAFA
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DECLARATION
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Class FrameArena
+///
+/// Inherits from Object
+///
+/// Implements a bump pointer allocator for data that lives for no longer than the current game frame.
+/// The whole arena is released at once at the end of each game frame, so its blocks must not be
+/// freed individually nor kept around beyond that. In non release builds, each block is stamped
+/// with the game frame in which it was allocated to detect pointers that escape it.
+static class FrameArena : Object
+{
+	/// @publicsection
+
+	/// Allocate a block big enough to hold the provided amount of bytes.
+	/// @param numberOfBytes: Total number of bytes to allocate
+	/// @return A pointer to the allocated block; NULL if there is not enough space left in the arena
+	static void* allocate(uint32 numberOfBytes);
+
+	/// Release all the blocks allocated during the current game frame.
+	static void reset();
+
+	/// Check if the provided pointer belongs to the arena.
+	/// @param pointer: Pointer to check
+	/// @return True if the pointer lies inside the arena
+	static bool contains(const void* pointer);
+
+	/// Check if the provided block was allocated during the current game frame. Meant for debug
+	/// assertions at the consumers; always returns true in release builds if the block belongs to the arena.
+	/// @param pointer: Pointer to a block returned by FrameArena::allocate
+	/// @return True if the block is still valid
+	static bool isValid(const void* pointer);
+
+	/// Retrieve the number of bytes used during the current game frame.
+	/// @return Number of used bytes
+	static uint32 getUsedBytes();
+
+	/// Print the arena's statistics.
+	/// @param x: Screen x coordinate where to print
+	/// @param y: Screen y coordinate where to print
+	static void print(int32 x, int32 y);
+}
+
+#endif
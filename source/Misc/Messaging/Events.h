@@ -34,6 +34,10 @@ enum Events
 	kEventSecondChanged,
 	kEventMinuteChanged,
 	kEventNextSecondStarted,
+	kEventClockAlarm,
+
+	// Profiler
+	kEventProfilerBudgetExceeded,
 
 	// DisplayUnit
 	kEventDisplayUnitTimeError,
@@ -53,6 +57,8 @@ enum Events
 	// Communications
 	kEventCommunicationsConnected,
 	kEventCommunicationsTransmissionCompleted,
+	kEventLinkChannelSnapshotReceived,
+	kEventLinkChannelMessageReceived,
 
 	// State machine
 	kEventStateMachineWillCleanStack,
@@ -0,0 +1,617 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <Communications.h>
+#include <Mem.h>
+#include <Printer.h>
+#include <Singleton.h>
+#include <Timer.h>
+
+#include "LinkChannel.h"
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#define __LINK_CHANNEL_PACKET_MAGIC					0xA0
+#define __LINK_CHANNEL_PACKET_MAGIC_MASK			0xF0
+#define __LINK_CHANNEL_PACKET_DELTA					0x01
+#define __LINK_CHANNEL_PACKET_ACKNOWLEDGE			0x02
+#define __LINK_CHANNEL_PACKET_SNAPSHOT				0x04
+#define __LINK_CHANNEL_PACKET_HEADER_SIZE			5
+#define __LINK_CHANNEL_MESSAGE_HEADER_SIZE			2
+#define __LINK_CHANNEL_HISTORY_MASK					(__LINK_CHANNEL_SNAPSHOT_HISTORY - 1)
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PUBLIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void LinkChannel::configure(uint16 snapshotSize, uint16 packetSize)
+{
+	NM_ASSERT(__LINK_CHANNEL_MAXIMUM_SNAPSHOT_SIZE >= snapshotSize, "LinkChannel::configure: snapshot too big");
+	NM_ASSERT(__LINK_CHANNEL_MAXIMUM_PACKET_SIZE >= packetSize, "LinkChannel::configure: packet too big");
+	NM_ASSERT
+	(
+		__LINK_CHANNEL_PACKET_HEADER_SIZE + snapshotSize <= packetSize,
+		"LinkChannel::configure: packet cannot hold a full snapshot"
+	);
+
+	this->snapshotSize = __LINK_CHANNEL_MAXIMUM_SNAPSHOT_SIZE < snapshotSize ? __LINK_CHANNEL_MAXIMUM_SNAPSHOT_SIZE : snapshotSize;
+	this->packetSize = __LINK_CHANNEL_MAXIMUM_PACKET_SIZE < packetSize ? __LINK_CHANNEL_MAXIMUM_PACKET_SIZE : packetSize;
+
+	LinkChannel::reset(this);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void LinkChannel::reset()
+{
+	if(this->transferring && !this->loopback)
+	{
+		Communications::cancelCommunications();
+	}
+
+	this->sequence = 0;
+	this->acknowledgedSequence = 0;
+	this->remoteSequence = 0;
+	this->messagesBytes = 0;
+	this->receivedMessage = NULL;
+	this->receivedMessageType = 0;
+	this->receivedMessageSize = 0;
+	this->hasAcknowledgedSnapshot = false;
+	this->hasRemoteSnapshot = false;
+	this->transferring = false;
+	this->throughputStartTime = Timer::getTotalElapsedMilliseconds();
+	this->throughputBytes = 0;
+
+	for(int16 i = 0; i < __LINK_CHANNEL_SNAPSHOT_HISTORY; i++)
+	{
+		this->receivedSequences[i] = 0;
+		this->sentTimes[i] = 0;
+	}
+
+	Mem::clear((uint8*)&this->statistics, sizeof(LinkChannelStatistics));
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void LinkChannel::setSnapshot(const uint8* localSnapshot)
+{
+	this->localSnapshot = localSnapshot;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+const uint8* LinkChannel::getRemoteSnapshot()
+{
+	if(!this->hasRemoteSnapshot)
+	{
+		return NULL;
+	}
+
+	return this->receivedSnapshots[this->remoteSequence & __LINK_CHANNEL_HISTORY_MASK];
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+bool LinkChannel::queueMessage(uint8 type, const void* data, uint8 size)
+{
+	NM_ASSERT(0 != type, "LinkChannel::queueMessage: type 0 is reserved");
+
+	if
+	(
+		0 == type
+		||
+		__LINK_CHANNEL_MESSAGES_BUFFER_SIZE < this->messagesBytes + __LINK_CHANNEL_MESSAGE_HEADER_SIZE + size
+		||
+		// The message travels in the same packet as the snapshot
+		this->packetSize < __LINK_CHANNEL_PACKET_HEADER_SIZE + this->snapshotSize + __LINK_CHANNEL_MESSAGE_HEADER_SIZE + size
+	)
+	{
+		this->statistics.droppedMessages++;
+		return false;
+	}
+
+	this->messages[this->messagesBytes++] = type;
+	this->messages[this->messagesBytes++] = size;
+
+	Mem::copyBYTE(&this->messages[this->messagesBytes], (const uint8*)data, size);
+
+	this->messagesBytes += size;
+
+	return true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+const uint8* LinkChannel::getReceivedMessage(uint8* type, uint8* size)
+{
+	if(NULL != type)
+	{
+		*type = this->receivedMessageType;
+	}
+
+	if(NULL != size)
+	{
+		*size = this->receivedMessageSize;
+	}
+
+	return this->receivedMessage;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void LinkChannel::setLoopback(bool loopback)
+{
+	if(this->loopback != loopback)
+	{
+		LinkChannel::reset(this);
+	}
+
+	this->loopback = loopback;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void LinkChannel::update()
+{
+	if(this->transferring || 0 == this->packetSize)
+	{
+		return;
+	}
+
+	if(!this->loopback && !Communications::isConnected())
+	{
+		return;
+	}
+
+	LinkChannel::buildPacket(this);
+
+	if(this->loopback)
+	{
+		Mem::copyBYTE(this->incomingPacket, this->outgoingPacket, this->packetSize);
+		LinkChannel::processPacket(this);
+		return;
+	}
+
+	this->transferring = true;
+
+	if
+	(
+		!Communications::sendAndReceiveDataAsync
+		(
+			__LINK_CHANNEL_TRANSFER_MESSAGE, this->outgoingPacket, this->packetSize, ListenerObject::safeCast(this)
+		)
+	)
+	{
+		this->transferring = false;
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+LinkChannelStatistics LinkChannel::getStatistics()
+{
+	return this->statistics;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void LinkChannel::print(int32 x, int32 y)
+{
+	Printer::text("LINK CHANNEL", x, y++, NULL);
+	y++;
+	Printer::text("Transfers:", x, y, NULL);
+	Printer::int32(this->statistics.transfers, x + 14, y++, NULL);
+	Printer::text("Bytes/s:", x, y, NULL);
+	Printer::int32(this->statistics.bytesPerSecond, x + 14, y++, NULL);
+	Printer::text("Saved bytes:", x, y, NULL);
+	Printer::int32(this->statistics.savedBytes, x + 14, y++, NULL);
+	Printer::text("RTT (ms):", x, y, NULL);
+	Printer::int32(this->statistics.roundTripMS, x + 14, y, NULL);
+	Printer::int32(this->statistics.averageRoundTripMS, x + 19, y++, NULL);
+	Printer::text("Messages:", x, y, NULL);
+	Printer::int32(this->statistics.sentMessages, x + 14, y, NULL);
+	Printer::int32(this->statistics.receivedMessages, x + 19, y++, NULL);
+	Printer::text("Dropped:", x, y, NULL);
+	Printer::int32(this->statistics.droppedMessages, x + 14, y++, NULL);
+	Printer::text("Rejected:", x, y, NULL);
+	Printer::int32(this->statistics.rejectedSnapshots, x + 14, y++, NULL);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+bool LinkChannel::onEvent(ListenerObject eventFirer, uint16 eventCode)
+{
+	switch(eventCode)
+	{
+		case kEventCommunicationsTransmissionCompleted:
+		{
+			if(!this->transferring)
+			{
+				return false;
+			}
+
+			this->transferring = false;
+
+			const uint8* receivedData = Communications::getReceivedData();
+
+			if(NULL != receivedData)
+			{
+				Mem::copyBYTE(this->incomingPacket, receivedData, this->packetSize);
+				LinkChannel::processPacket(this);
+			}
+
+			return false;
+		}
+	}
+
+	return Base::onEvent(this, eventFirer, eventCode);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void LinkChannel::constructor()
+{
+	// Always explicitly call the base's constructor
+	Base::constructor();
+
+	this->localSnapshot = NULL;
+	this->snapshotSize = 0;
+	this->packetSize = 0;
+	this->loopback = false;
+	this->transferring = false;
+
+	LinkChannel::reset(this);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void LinkChannel::destructor()
+{
+	// Always explicitly call the base's destructor
+	Base::destructor();
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void LinkChannel::buildPacket()
+{
+	uint8* packet = this->outgoingPacket;
+	uint16 position = __LINK_CHANNEL_PACKET_HEADER_SIZE;
+	uint8 flags = __LINK_CHANNEL_PACKET_MAGIC;
+
+	Mem::clear(packet, this->packetSize);
+
+	if(this->hasRemoteSnapshot)
+	{
+		flags |= __LINK_CHANNEL_PACKET_ACKNOWLEDGE;
+	}
+
+	if(NULL != this->localSnapshot && 0 < this->snapshotSize)
+	{
+		uint8* sentSnapshot = this->sentSnapshots[++this->sequence & __LINK_CHANNEL_HISTORY_MASK];
+
+		Mem::copyBYTE(sentSnapshot, this->localSnapshot, this->snapshotSize);
+		this->sentTimes[this->sequence & __LINK_CHANNEL_HISTORY_MASK] = Timer::getTotalElapsedMilliseconds();
+
+		int16 encodedBytes = -1;
+
+		if
+		(
+			this->hasAcknowledgedSnapshot
+			&&
+			__LINK_CHANNEL_SNAPSHOT_HISTORY > (uint8)(this->sequence - this->acknowledgedSequence)
+		)
+		{
+			encodedBytes = LinkChannel::encodeDelta
+			(
+				this,
+				sentSnapshot,
+				this->sentSnapshots[this->acknowledgedSequence & __LINK_CHANNEL_HISTORY_MASK],
+				&packet[position]
+			);
+		}
+
+		if(0 <= encodedBytes)
+		{
+			flags |= __LINK_CHANNEL_PACKET_DELTA;
+			this->statistics.savedBytes += this->snapshotSize - encodedBytes;
+		}
+		else
+		{
+			encodedBytes = this->snapshotSize;
+			Mem::copyBYTE(&packet[position], sentSnapshot, this->snapshotSize);
+		}
+
+		flags |= __LINK_CHANNEL_PACKET_SNAPSHOT;
+		packet[3] = this->acknowledgedSequence;
+		packet[4] = encodedBytes;
+		position += encodedBytes;
+	}
+
+	packet[0] = flags;
+	packet[1] = this->sequence;
+	packet[2] = this->remoteSequence;
+
+	// Batch as many whole queued messages as fit in the remaining space
+	uint16 messagesPosition = 0;
+
+	while(messagesPosition < this->messagesBytes)
+	{
+		uint16 messageBytes = __LINK_CHANNEL_MESSAGE_HEADER_SIZE + this->messages[messagesPosition + 1];
+
+		if(position + messageBytes > this->packetSize)
+		{
+			break;
+		}
+
+		Mem::copyBYTE(&packet[position], &this->messages[messagesPosition], messageBytes);
+
+		position += messageBytes;
+		messagesPosition += messageBytes;
+		this->statistics.sentMessages++;
+	}
+
+	this->statistics.payloadBytes += position - __LINK_CHANNEL_PACKET_HEADER_SIZE;
+	this->throughputBytes += position - __LINK_CHANNEL_PACKET_HEADER_SIZE;
+
+	if(0 < messagesPosition)
+	{
+		this->messagesBytes -= messagesPosition;
+
+		for(uint16 i = 0; i < this->messagesBytes; i++)
+		{
+			this->messages[i] = this->messages[messagesPosition + i];
+		}
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void LinkChannel::processPacket()
+{
+	const uint8* packet = this->incomingPacket;
+	uint8 flags = packet[0];
+
+	this->statistics.transfers++;
+
+	LinkChannel::updateThroughput(this);
+
+	if(__LINK_CHANNEL_PACKET_MAGIC != (flags & __LINK_CHANNEL_PACKET_MAGIC_MASK))
+	{
+		return;
+	}
+
+	if(0 != (flags & __LINK_CHANNEL_PACKET_ACKNOWLEDGE))
+	{
+		uint8 acknowledgedSequence = packet[2];
+
+		if
+		(
+			__LINK_CHANNEL_SNAPSHOT_HISTORY > (uint8)(this->sequence - acknowledgedSequence)
+			&&
+			(
+				!this->hasAcknowledgedSnapshot 
+				|| 
+				(
+					// Repeated acks would time the same snapshot again against a later time
+					0 != (uint8)(acknowledgedSequence - this->acknowledgedSequence)
+					&&
+					0x80 > (uint8)(acknowledgedSequence - this->acknowledgedSequence)
+				)
+			)
+		)
+		{
+			uint16 roundTripMS =
+				Timer::getTotalElapsedMilliseconds() - this->sentTimes[acknowledgedSequence & __LINK_CHANNEL_HISTORY_MASK];
+
+			this->statistics.roundTripMS = roundTripMS;
+			this->statistics.averageRoundTripMS =
+				0 == this->statistics.averageRoundTripMS ?
+					roundTripMS
+					:
+					(this->statistics.averageRoundTripMS * 7 + roundTripMS) >> 3;
+
+			this->acknowledgedSequence = acknowledgedSequence;
+			this->hasAcknowledgedSnapshot = true;
+		}
+	}
+
+	uint16 position = __LINK_CHANNEL_PACKET_HEADER_SIZE;
+
+	if(0 != (flags & __LINK_CHANNEL_PACKET_SNAPSHOT))
+	{
+		uint8 remoteSequence = packet[1];
+		uint8 baselineSequence = packet[3];
+		uint8 encodedBytes = packet[4];
+
+		uint8* receivedSnapshot = this->receivedSnapshots[remoteSequence & __LINK_CHANNEL_HISTORY_MASK];
+		bool decoded = false;
+
+		if(0 != (flags & __LINK_CHANNEL_PACKET_DELTA))
+		{
+			if
+			(
+				this->hasRemoteSnapshot
+				&&
+				baselineSequence == this->receivedSequences[baselineSequence & __LINK_CHANNEL_HISTORY_MASK]
+				&&
+				__LINK_CHANNEL_SNAPSHOT_HISTORY > (uint8)(this->remoteSequence - baselineSequence)
+				&&
+				(remoteSequence & __LINK_CHANNEL_HISTORY_MASK) != (baselineSequence & __LINK_CHANNEL_HISTORY_MASK)
+			)
+			{
+				decoded = LinkChannel::decodeDelta
+				(
+					this,
+					&packet[position],
+					encodedBytes,
+					this->receivedSnapshots[baselineSequence & __LINK_CHANNEL_HISTORY_MASK],
+					receivedSnapshot
+				);
+			}
+		}
+		else if(encodedBytes == this->snapshotSize)
+		{
+			Mem::copyBYTE(receivedSnapshot, &packet[position], this->snapshotSize);
+			decoded = true;
+		}
+
+		position += encodedBytes;
+
+		if(decoded)
+		{
+			this->receivedSequences[remoteSequence & __LINK_CHANNEL_HISTORY_MASK] = remoteSequence;
+			this->remoteSequence = remoteSequence;
+			this->hasRemoteSnapshot = true;
+
+			if(!isDeleted(this->events))
+			{
+				LinkChannel::fireEvent(this, kEventLinkChannelSnapshotReceived);
+			}
+		}
+		else
+		{
+			this->statistics.rejectedSnapshots++;
+		}
+	}
+
+	while(position + __LINK_CHANNEL_MESSAGE_HEADER_SIZE <= this->packetSize && 0 != packet[position])
+	{
+		uint8 size = packet[position + 1];
+
+		if(position + __LINK_CHANNEL_MESSAGE_HEADER_SIZE + size > this->packetSize)
+		{
+			break;
+		}
+
+		this->receivedMessageType = packet[position];
+		this->receivedMessageSize = size;
+		this->receivedMessage = &packet[position + __LINK_CHANNEL_MESSAGE_HEADER_SIZE];
+		this->statistics.receivedMessages++;
+
+		if(!isDeleted(this->events))
+		{
+			LinkChannel::fireEvent(this, kEventLinkChannelMessageReceived);
+		}
+
+		position += __LINK_CHANNEL_MESSAGE_HEADER_SIZE + size;
+	}
+
+	this->receivedMessage = NULL;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+int16 LinkChannel::encodeDelta(const uint8* snapshot, const uint8* baseline, uint8* output)
+{
+	// The difference is encoded as pairs of [unchanged bytes][changed bytes] counts
+	// followed by the changed bytes xored against the baseline
+	int16 encodedBytes = 0;
+	uint16 i = 0;
+
+	while(i < this->snapshotSize)
+	{
+		uint8 unchangedBytes = 0;
+		uint8 changedBytes = 0;
+
+		for(; i < this->snapshotSize && 0xFF > unchangedBytes && snapshot[i] == baseline[i]; i++, unchangedBytes++);
+
+		if(i >= this->snapshotSize)
+		{
+			// Trailing unchanged bytes need no encoding
+			break;
+		}
+
+		if(encodedBytes + 2 > this->snapshotSize)
+		{
+			return -1;
+		}
+
+		uint16 countsPosition = encodedBytes;
+
+		encodedBytes += 2;
+
+		for(; i < this->snapshotSize && 0xFF > changedBytes && snapshot[i] != baseline[i]; i++, changedBytes++)
+		{
+			if(encodedBytes >= this->snapshotSize)
+			{
+				return -1;
+			}
+
+			output[encodedBytes++] = snapshot[i] ^ baseline[i];
+		}
+
+		output[countsPosition] = unchangedBytes;
+		output[countsPosition + 1] = changedBytes;
+	}
+
+	// Only worth it if smaller than the raw snapshot
+	return encodedBytes < this->snapshotSize ? encodedBytes : -1;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+bool LinkChannel::decodeDelta(const uint8* input, uint8 encodedBytes, const uint8* baseline, uint8* snapshot)
+{
+	Mem::copyBYTE(snapshot, baseline, this->snapshotSize);
+
+	uint16 i = 0;
+	uint16 position = 0;
+
+	while(position + 2 <= encodedBytes)
+	{
+		i += input[position];
+
+		uint8 changedBytes = input[position + 1];
+
+		position += 2;
+
+		if(i + changedBytes > this->snapshotSize || position + changedBytes > encodedBytes)
+		{
+			return false;
+		}
+
+		for(; 0 < changedBytes; changedBytes--, i++)
+		{
+			snapshot[i] ^= input[position++];
+		}
+	}
+
+	return position == encodedBytes;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void LinkChannel::updateThroughput()
+{
+	uint32 currentTime = Timer::getTotalElapsedMilliseconds();
+
+	if(__MILLISECONDS_PER_SECOND <= currentTime - this->throughputStartTime)
+	{
+		this->statistics.bytesPerSecond = this->throughputBytes;
+		this->throughputBytes = 0;
+		this->throughputStartTime = currentTime;
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
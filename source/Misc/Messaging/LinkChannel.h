@@ -0,0 +1,222 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+#ifndef LINK_CHANNEL_H_
+#define LINK_CHANNEL_H_
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <ListenerObject.h>
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#ifndef __LINK_CHANNEL_MAXIMUM_SNAPSHOT_SIZE
+#define __LINK_CHANNEL_MAXIMUM_SNAPSHOT_SIZE		48
+#endif
+
+#ifndef __LINK_CHANNEL_MAXIMUM_PACKET_SIZE
+#define __LINK_CHANNEL_MAXIMUM_PACKET_SIZE			96
+#endif
+
+#ifndef __LINK_CHANNEL_MESSAGES_BUFFER_SIZE
+#define __LINK_CHANNEL_MESSAGES_BUFFER_SIZE			128
+#endif
+
+/// Number of sent and received snapshots kept as delta baselines (must be a power of 2)
+#define __LINK_CHANNEL_SNAPSHOT_HISTORY				4
+
+/// Control message used for the channel's transfers
+#define __LINK_CHANNEL_TRANSFER_MESSAGE				0x4C4E4B31
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DATA
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Statistics of the link channel
+/// @memberof LinkChannel
+typedef struct LinkChannelStatistics
+{
+	/// Total completed transfers
+	uint32 transfers;
+
+	/// Total bytes of snapshots and messages delivered to the peer
+	uint32 payloadBytes;
+
+	/// Bytes saved by delta encoding the snapshots
+	uint32 savedBytes;
+
+	/// Total messages sent
+	uint32 sentMessages;
+
+	/// Total messages received
+	uint32 receivedMessages;
+
+	/// Payload bytes delivered during the last elapsed second
+	uint16 bytesPerSecond;
+
+	/// Milliseconds between sending the last acknowledged snapshot and receiving its acknowledgement
+	uint16 roundTripMS;
+
+	/// Running average of the round trip in milliseconds
+	uint16 averageRoundTripMS;
+
+	/// Received packets whose snapshot could not be decoded
+	uint16 rejectedSnapshots;
+
+	/// Messages that did not fit in the outgoing buffer
+	uint16 droppedMessages;
+
+} LinkChannelStatistics;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DECLARATION
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Class LinkChannel
+///
+/// Inherits from ListenerObject
+///
+/// Synchronizes a snapshot of the game's state and batches messages over the EXT port.
+/// Snapshots are delta encoded against the last one acknowledged by the peer.
+singleton class LinkChannel : ListenerObject
+{
+	/// @protectedsection
+
+	/// Snapshots sent to the peer, indexed by sequence
+	uint8 sentSnapshots[__LINK_CHANNEL_SNAPSHOT_HISTORY][__LINK_CHANNEL_MAXIMUM_SNAPSHOT_SIZE];
+
+	/// Snapshots received from the peer, indexed by sequence
+	uint8 receivedSnapshots[__LINK_CHANNEL_SNAPSHOT_HISTORY][__LINK_CHANNEL_MAXIMUM_SNAPSHOT_SIZE];
+
+	/// Sequence of each received snapshot
+	uint8 receivedSequences[__LINK_CHANNEL_SNAPSHOT_HISTORY];
+
+	/// Time at which each sent snapshot was sent
+	uint32 sentTimes[__LINK_CHANNEL_SNAPSHOT_HISTORY];
+
+	/// Outgoing packet
+	uint8 outgoingPacket[__LINK_CHANNEL_MAXIMUM_PACKET_SIZE];
+
+	/// Incoming packet
+	uint8 incomingPacket[__LINK_CHANNEL_MAXIMUM_PACKET_SIZE];
+
+	/// Queued outgoing messages
+	uint8 messages[__LINK_CHANNEL_MESSAGES_BUFFER_SIZE];
+
+	/// Statistics
+	LinkChannelStatistics statistics;
+
+	/// Game's state to synchronize
+	const uint8* localSnapshot;
+
+	/// Data of the message being notified through kEventLinkChannelMessageReceived
+	const uint8* receivedMessage;
+
+	/// Time at which the current second of throughput statistics started
+	uint32 throughputStartTime;
+
+	/// Payload bytes delivered during the current second
+	uint32 throughputBytes;
+
+	/// Bytes used by the queued outgoing messages
+	uint16 messagesBytes;
+
+	/// Size of the snapshots
+	uint16 snapshotSize;
+
+	/// Size of the packets exchanged on each transfer
+	uint16 packetSize;
+
+	/// Sequence of the last sent snapshot
+	uint8 sequence;
+
+	/// Last local sequence acknowledged by the peer
+	uint8 acknowledgedSequence;
+
+	/// Last peer's sequence that was successfully decoded
+	uint8 remoteSequence;
+
+	/// Type of the message being notified through kEventLinkChannelMessageReceived
+	uint8 receivedMessageType;
+
+	/// Size of the message being notified through kEventLinkChannelMessageReceived
+	uint8 receivedMessageSize;
+
+	/// True once the peer has acknowledged any snapshot
+	bool hasAcknowledgedSnapshot;
+
+	/// True once a snapshot from the peer has been decoded
+	bool hasRemoteSnapshot;
+
+	/// True while a transfer is in flight
+	bool transferring;
+
+	/// If true, packets are echoed back locally instead of being sent over the EXT port
+	bool loopback;
+
+	/// @publicsection
+
+	/// Configure the channel. Both peers must use the same configuration.
+	/// @param snapshotSize: Size of the snapshots to synchronize
+	/// @param packetSize: Size of the packets exchanged on each transfer
+	void configure(uint16 snapshotSize, uint16 packetSize);
+
+	/// Reset the channel's state.
+	void reset();
+
+	/// Set the game's state to synchronize on each transfer.
+	/// @param localSnapshot: Pointer to a buffer of snapshotSize bytes
+	void setSnapshot(const uint8* localSnapshot);
+
+	/// Retrieve the last snapshot received from the peer.
+	/// @return Pointer to the peer's snapshot; NULL if none has been received yet
+	const uint8* getRemoteSnapshot();
+
+	/// Queue a message to be sent in the next transfers.
+	/// @param type: Message's type (must not be 0)
+	/// @param data: Message's data
+	/// @param size: Size of the message's data
+	/// @return True if the message was queued
+	bool queueMessage(uint8 type, const void* data, uint8 size);
+
+	/// Retrieve the message being notified through kEventLinkChannelMessageReceived.
+	/// @param type: Pointer to store the message's type
+	/// @param size: Pointer to store the size of the message's data
+	/// @return Pointer to the message's data
+	const uint8* getReceivedMessage(uint8* type, uint8* size);
+
+	/// Echo packets back locally instead of sending them over the EXT port, so the
+	/// channel can be exercised without a second system attached.
+	/// @param loopback: If true, enables the loopback
+	void setLoopback(bool loopback);
+
+	/// Start a new transfer if none is in flight.
+	void update();
+
+	/// Retrieve the channel's statistics.
+	/// @return Statistics
+	LinkChannelStatistics getStatistics();
+
+	/// Print the channel's statistics.
+	/// @param x: Screen x coordinate where to print
+	/// @param y: Screen y coordinate where to print
+	void print(int32 x, int32 y);
+
+	/// Process an event that the instance is listen for.
+	/// @param eventFirer: ListenerObject that signals the event
+	/// @param eventCode: Code of the firing event
+	/// @return False if the listener has to be removed; true to keep it
+	override bool onEvent(ListenerObject eventFirer, uint16 eventCode);
+}
+
+#endif
@@ -118,6 +118,8 @@ void ListenerObject::addEventListener(ListenerObject listener, uint16 eventCode)
 	}
 
 	Hardware::resumeInterrupts();
+
+	ListenerObject::eventListenerAdded(this, eventCode);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -307,6 +309,11 @@ void ListenerObject::discardMessages(uint32 message)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+void ListenerObject::eventListenerAdded(uint16 eventCode __attribute__((unused)))
+{}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 bool ListenerObject::onEvent(ListenerObject eventFirer __attribute__((unused)), uint16 eventCode __attribute__((unused)))
 {
 	return false;
@@ -116,6 +116,10 @@ abstract class ListenerObject : Object
 	/// @param message: The message's code to discard
 	void discardMessages(uint32 message);
 
+	/// A listener has been registered for one of the events that the instance fires.
+	/// @param eventCode: Code of the event that the listener listens for
+	virtual void eventListenerAdded(uint16 eventCode);
+
 	/// Process an event that the instance is listening for.
 	/// @param eventFirer: ListenerObject that signals the event
 	/// @param eventCode: Code of the firing event
@@ -14,9 +14,16 @@
 #include <ClockManager.h>
 #include <Printer.h>
 #include <Utilities.h>
+#include <VirtualList.h>
 
 #include "Clock.h"
 
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DECLARATIONS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+friend class VirtualList;
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' PUBLIC STATIC METHODS
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -129,10 +136,12 @@ void Clock::constructor()
 
 	// Initialize time
 	this->milliseconds = 0;
+	this->referenceTime = ClockManager::getTime(ClockManager::getInstance());
+	this->deadline = 0;
+	this->alarm = 0;
 
 	// Initialize state
 	this->paused = true;
-
 	this->previousSecond = 0;
 	this->previousMinute = 0;
 
@@ -155,23 +164,33 @@ void Clock::destructor()
 
 void Clock::start()
 {
-	Clock::reset(this);
 	this->paused = false;
+	Clock::reset(this);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 void Clock::stop()
 {
-	Clock::reset(this);
 	this->paused = true;
+	Clock::reset(this);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 void Clock::pause(bool pause)
 {
+	if(pause == this->paused)
+	{
+		return;
+	}
+
+	// Keep the time elapsed so far and count from now on when resumed
+	Clock::synchronize(this);
+
 	this->paused = pause;
+
+	Clock::schedule(this);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -179,15 +198,31 @@ void Clock::pause(bool pause)
 void Clock::reset()
 {
 	this->milliseconds = 0;
+	this->referenceTime = ClockManager::getTime(ClockManager::getInstance());
 	this->previousSecond = 0;
 	this->previousMinute = 0;
+
+	Clock::schedule(this);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Clock::eventListenerAdded(uint16 eventCode __attribute__((unused)))
+{
+	// Clocks without listeners are not ticked, so the last second and minute seen are stale
+	if(1 == VirtualList::getCount(this->events))
+	{
+		this->previousSecond = Clock::getSeconds(this);
+		this->previousMinute = Clock::getMinutes(this);
+	}
+
+	Clock::schedule(this);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 void Clock::update(uint32 elapsedMilliseconds)
 {
-	// Increase count
 	if(this->paused)
 	{
 		return;
@@ -195,8 +230,25 @@ void Clock::update(uint32 elapsedMilliseconds)
 
 	this->milliseconds += elapsedMilliseconds;
 
+	Clock::tick(this);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Clock::tick()
+{
+	Clock::synchronize(this);
+
 	if(NULL != this->events)
 	{
+		if(0 != this->alarm && this->alarm <= this->milliseconds)
+		{
+			this->alarm = 0;
+
+			Clock::fireEvent(this, kEventClockAlarm);
+			NM_ASSERT(!isDeleted(this), "Clock::tick: deleted this during kEventClockAlarm");
+		}
+
 		uint32 currentSecond = Clock::getSeconds(this);
 
 		if(currentSecond != this->previousSecond)
@@ -204,7 +256,7 @@ void Clock::update(uint32 elapsedMilliseconds)
 			this->previousSecond = currentSecond;
 
 			Clock::fireEvent(this, kEventSecondChanged);
-			NM_ASSERT(!isDeleted(this), "Clock::update: deleted this during kEventSecondChanged");
+			NM_ASSERT(!isDeleted(this), "Clock::tick: deleted this during kEventSecondChanged");
 
 			uint32 currentMinute = Clock::getMinutes(this);
 
@@ -213,10 +265,43 @@ void Clock::update(uint32 elapsedMilliseconds)
 				this->previousMinute = currentMinute;
 
 				Clock::fireEvent(this, kEventMinuteChanged);
-				NM_ASSERT(!isDeleted(this), "Clock::update: deleted this during kEventMinuteChanged");
+				NM_ASSERT(!isDeleted(this), "Clock::tick: deleted this during kEventMinuteChanged");
 			}
 		}
 	}
+	else
+	{
+		this->alarm = this->alarm <= this->milliseconds ? 0 : this->alarm;
+		this->previousSecond = Clock::getSeconds(this);
+		this->previousMinute = Clock::getMinutes(this);
+	}
+
+	Clock::schedule(this);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Clock::setAlarm(uint32 milliseconds)
+{
+	this->alarm = milliseconds;
+
+	Clock::schedule(this);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Clock::cancelAlarm()
+{
+	this->alarm = 0;
+
+	Clock::schedule(this);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+uint32 Clock::getAlarm()
+{
+	return this->alarm;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -230,28 +315,80 @@ bool Clock::isPaused()
 
 uint32 Clock::getMilliseconds()
 {
-	return this->milliseconds;
+	if(this->paused)
+	{
+		return this->milliseconds;
+	}
+
+	return this->milliseconds + ClockManager::getTime(ClockManager::getInstance()) - this->referenceTime;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 uint32 Clock::getSeconds()
 {
-	return (uint32)(this->milliseconds / __MILLISECONDS_PER_SECOND);
+	return (uint32)(Clock::getMilliseconds(this) / __MILLISECONDS_PER_SECOND);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 uint32 Clock::getMinutes()
 {
-	return (uint32)(this->milliseconds / (__MILLISECONDS_PER_SECOND * 60));
+	return (uint32)(Clock::getMilliseconds(this) / (__MILLISECONDS_PER_SECOND * 60));
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 void Clock::print(int32 col, int32 row, const char* font)
 {
-	Clock::printTime(this->milliseconds, col, row, font, kTimePrecision0);
+	Clock::printTime(Clock::getMilliseconds(this), col, row, font, kTimePrecision0);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Clock::synchronize()
+{
+	this->milliseconds = Clock::getMilliseconds(this);
+	this->referenceTime = ClockManager::getTime(ClockManager::getInstance());
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void Clock::schedule()
+{
+	ClockManager clockManager = ClockManager::getInstance();
+
+	bool hasEventListeners = NULL != this->events && NULL != this->events->head;
+
+	// The elapsed time is computed when read, so there is no need to tick a clock that has nothing to fire
+	if(this->paused || (!hasEventListeners && 0 == this->alarm))
+	{
+		ClockManager::unschedule(clockManager, this);
+		return;
+	}
+
+	uint32 milliseconds = Clock::getMilliseconds(this);
+
+	// The next boundary is the next second change if anything listens for it, unless the alarm goes off earlier
+	uint32 boundary = 
+		hasEventListeners ? (milliseconds / __MILLISECONDS_PER_SECOND + 1) * __MILLISECONDS_PER_SECOND : this->alarm;
+
+	if(0 != this->alarm && this->alarm < boundary)
+	{
+		boundary = this->alarm > milliseconds ? this->alarm : milliseconds;
+	}
+	else if(boundary < milliseconds)
+	{
+		boundary = milliseconds;
+	}
+
+	ClockManager::schedule(clockManager, this, ClockManager::getTime(clockManager) + boundary - milliseconds);
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
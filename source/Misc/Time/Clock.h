@@ -36,14 +36,25 @@ enum ClockPrintPrecision
 ///
 /// Inherits from ListenerObject
 ///
-/// Implements simple clock that can keep track of time and print itself.
+/// Implements simple clock that can keep track of time and print itself. The elapsed time is derived from 
+/// the ClockManager's time, so clocks are only ticked when they reach their next second change or alarm, 
+/// and not at all if nothing listens for their events and they have no alarm set.
 class Clock : ListenerObject
 {
 	/// @protectedsection
 
-	/// Elapsed time in milliseconds
+	/// Elapsed time in milliseconds when the clock was last synchronized with the clock manager's time
 	uint32 milliseconds;
 
+	/// Clock manager's time when the clock was last synchronized with it
+	uint32 referenceTime;
+
+	/// Clock manager's time at which the clock reaches its next boundary
+	uint32 deadline;
+
+	/// Elapsed time at which kEventClockAlarm is fired (0 if there is no alarm set)
+	uint32 alarm;
+
 	/// Previous elapsed second
 	uint32 previousSecond;
 
@@ -105,10 +116,28 @@ class Clock : ListenerObject
 	/// Reset the clock's elapsed time
 	void reset();
 
-	/// Update the clock's elapsed time
-	/// @param elapsedMilliseconds: Milliseconds that have passed since the previous call to the update method
+	/// A listener has been registered for one of the clock's events.
+	/// @param eventCode: Code of the event that the listener listens for
+	override void eventListenerAdded(uint16 eventCode);
+
+	/// Advance the clock's elapsed time on top of the time kept by the ClockManager.
+	/// @param elapsedMilliseconds: Milliseconds to add to the clock's elapsed time
 	void update(uint32 elapsedMilliseconds);
 
+	/// Fire the events for the boundaries that the clock's time has reached and schedule the next one.
+	void tick();
+
+	/// Set the elapsed time at which kEventClockAlarm has to be fired.
+	/// @param milliseconds: Elapsed time at which the alarm goes off
+	void setAlarm(uint32 milliseconds);
+
+	/// Cancel the alarm if any.
+	void cancelAlarm();
+
+	/// Retrieve the elapsed time at which kEventClockAlarm will be fired.
+	/// @return Elapsed time at which the alarm goes off (0 if there is no alarm set)
+	uint32 getAlarm();
+
 	/// Retrieve the clock's paused state
 	/// @return True if the clock is paused
 	bool isPaused();
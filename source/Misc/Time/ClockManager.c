@@ -13,6 +13,7 @@
 
 #include <Clock.h>
 #include <DebugConfig.h>
+#include <Hardware.h>
 #include <Singleton.h>
 #include <VirtualList.h>
 
@@ -22,6 +23,7 @@
 // CLASS' DECLARATIONS
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+friend class Clock;
 friend class VirtualNode;
 friend class VirtualList;
 
@@ -69,25 +71,90 @@ secure void ClockManager::unregister(Clock clock)
 	}
 
 	VirtualList::removeData(this->clocks, clock);
+
+	// The scheduled clocks are ticked from the game frame's start interrupt
+	Hardware::suspendInterrupts();
+
+	VirtualList::removeData(this->scheduledClocks, clock);
+
+	Hardware::resumeInterrupts();
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 secure void ClockManager::update(uint32 elapsedMilliseconds)
 {
-	if(isDeleted(this->clocks))
+	this->milliseconds += elapsedMilliseconds;
+
+	if(isDeleted(this->scheduledClocks))
 	{
 		return;
 	}
 
-	for(VirtualNode node = this->clocks->head; node ; node = node->next)
+	// Ticking a clock can schedule, unschedule or delete other clocks
+	while(NULL != this->scheduledClocks->head && Clock::safeCast(this->scheduledClocks->head->data)->deadline <= this->milliseconds)
 	{
-		Clock::update(node->data, elapsedMilliseconds);
+		Clock::tick(Clock::safeCast(VirtualList::popFront(this->scheduledClocks)));
 	}
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+secure void ClockManager::schedule(Clock clock, uint32 deadline)
+{
+	if(isDeleted(this->scheduledClocks))
+	{
+		return;
+	}
+
+	// The scheduled clocks are ticked from the game frame's start interrupt
+	Hardware::suspendInterrupts();
+
+	VirtualList::removeData(this->scheduledClocks, clock);
+
+	clock->deadline = deadline;
+
+	VirtualNode node = this->scheduledClocks->head;
+
+	for(; NULL != node && Clock::safeCast(node->data)->deadline <= deadline; node = node->next);
+
+	if(NULL == node)
+	{
+		VirtualList::pushBack(this->scheduledClocks, clock);
+	}
+	else
+	{
+		VirtualList::insertBefore(this->scheduledClocks, node, clock);
+	}
+
+	Hardware::resumeInterrupts();
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+secure void ClockManager::unschedule(Clock clock)
+{
+	if(isDeleted(this->scheduledClocks))
+	{
+		return;
+	}
+
+	Hardware::suspendInterrupts();
+
+	VirtualList::removeData(this->scheduledClocks, clock);
+
+	Hardware::resumeInterrupts();
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+uint32 ClockManager::getTime()
+{
+	return this->milliseconds;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' PRIVATE METHODS
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -99,14 +166,23 @@ void ClockManager::constructor()
 	// Always explicitly call the base's constructor 
 	Base::constructor();
 
-	// Create the clock list
+	// Create the clock lists
 	this->clocks = new VirtualList();
+	this->scheduledClocks = new VirtualList();
+
+	this->milliseconds = 0;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 void ClockManager::destructor()
 {
+	if(!isDeleted(this->scheduledClocks))
+	{
+		delete this->scheduledClocks;
+		this->scheduledClocks = NULL;
+	}
+
 	if(!isDeleted(this->clocks))
 	{
 		VirtualList clocks = this->clocks;
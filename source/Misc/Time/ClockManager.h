@@ -39,6 +39,12 @@ singleton class ClockManager : Object
 	/// Linked list of Clocks
 	VirtualList clocks;
 
+	/// Running clocks sorted by the time at which they reach their next boundary
+	VirtualList scheduledClocks;
+
+	/// Time elapsed since the manager was created in milliseconds
+	uint32 milliseconds;
+
 	/// @publicsection
 
 	/// Reset all the registered clocks.
@@ -52,9 +58,22 @@ singleton class ClockManager : Object
 	/// @param clock: Clock to unregister
 	void unregister(Clock clock);
 
-	/// Update the clocks.
+	/// Advance the time and tick the clocks whose next boundary is due.
 	/// @param elapsedMilliseconds: Milliseconds that passed since the previous call to this method
 	void update(uint32 elapsedMilliseconds);
+
+	/// Schedule a clock to be ticked when the manager's time reaches the provided deadline.
+	/// @param clock: Clock to schedule
+	/// @param deadline: Manager's time at which to tick the clock
+	void schedule(Clock clock, uint32 deadline);
+
+	/// Stop ticking a clock.
+	/// @param clock: Clock to unschedule
+	void unschedule(Clock clock);
+
+	/// Retrieve the time elapsed since the manager was created.
+	/// @return Elapsed time in milliseconds
+	uint32 getTime();
 }
 
 #endif
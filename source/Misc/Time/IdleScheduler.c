@@ -0,0 +1,269 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <DebugConfig.h>
+#include <Hardware.h>
+#include <Printer.h>
+#include <Singleton.h>
+#include <Timer.h>
+#include <VUEngine.h>
+
+#include "IdleScheduler.h"
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PUBLIC STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static bool IdleScheduler::registerJob(Object owner, IdleJob job)
+{
+	IdleScheduler idleScheduler = IdleScheduler::getInstance();
+
+	if(isDeleted(owner) || NULL == job)
+	{
+		return false;
+	}
+
+	for(int16 i = 0; i < idleScheduler->registeredJobs; i++)
+	{
+		if(owner == idleScheduler->jobs[i].owner && job == idleScheduler->jobs[i].job)
+		{
+			return true;
+		}
+	}
+
+	NM_ASSERT(__IDLE_SCHEDULER_MAXIMUM_JOBS > idleScheduler->registeredJobs, "IdleScheduler::registerJob: too many jobs");
+
+	if(__IDLE_SCHEDULER_MAXIMUM_JOBS <= idleScheduler->registeredJobs)
+	{
+		return false;
+	}
+
+	idleScheduler->jobs[idleScheduler->registeredJobs].owner = owner;
+	idleScheduler->jobs[idleScheduler->registeredJobs].job = job;
+	idleScheduler->registeredJobs++;
+
+	return true;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void IdleScheduler::unregisterJob(Object owner, IdleJob job)
+{
+	IdleScheduler idleScheduler = IdleScheduler::getInstance();
+
+	for(int16 i = idleScheduler->registeredJobs - 1; 0 <= i; i--)
+	{
+		if(owner == idleScheduler->jobs[i].owner && (NULL == job || job == idleScheduler->jobs[i].job))
+		{
+			IdleScheduler::removeJob(idleScheduler, i);
+		}
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void IdleScheduler::run()
+{
+	IdleScheduler idleScheduler = IdleScheduler::getInstance();
+
+	idleScheduler->usedTicks = 0;
+	idleScheduler->leftTicks = 0;
+	idleScheduler->jobSteps = 0;
+
+	// Number of consecutive jobs that reported no pending work
+	uint8 idleJobs = 0;
+
+	uint16 previousTimerCounter = Timer::getCurrentTimerCounter();
+
+	for(;;)
+	{
+		bool ranJob = false;
+
+		// The check and the halt must not be split by the interrupt that starts the game frame, 
+		// otherwise the CPU would sleep through it
+		Hardware::suspendInterrupts();
+
+		if(VUEngine::hasGameFrameStarted())
+		{
+			Hardware::resumeInterrupts();
+			break;
+		}
+
+		if(idleJobs < idleScheduler->registeredJobs)
+		{
+			Hardware::resumeInterrupts();
+
+			if(idleScheduler->registeredJobs <= idleScheduler->nextJob)
+			{
+				idleScheduler->nextJob = 0;
+			}
+
+			IdleJobRegistry* jobRegistry = &idleScheduler->jobs[idleScheduler->nextJob];
+
+			if(isDeleted(jobRegistry->owner))
+			{
+				IdleScheduler::removeJob(idleScheduler, idleScheduler->nextJob);
+				continue;
+			}
+
+			if(jobRegistry->job(jobRegistry->owner))
+			{
+				idleJobs = 0;
+			}
+			else
+			{
+				idleJobs++;
+			}
+
+			idleScheduler->nextJob++;
+			idleScheduler->jobSteps++;
+			ranJob = true;
+		}
+		else
+		{
+			// Nothing left to do, sleep until the next interrupt, which is at the latest
+			// the timer's or the VIP's GAMESTART. The interrupts stay suspended since the check
+			// and halting enables them right before stopping the CPU, so an interrupt raised in 
+			// between is serviced instead of being lost; the timer's interrupt bounds the sleep
+			// to one of its periods in the worst case
+			Hardware::halt();
+		}
+
+		uint16 currentTimerCounter = Timer::getCurrentTimerCounter();
+		uint32 elapsedTicks = IdleScheduler::computeElapsedTicks(previousTimerCounter, currentTimerCounter);
+		previousTimerCounter = currentTimerCounter;
+
+		if(ranJob)
+		{
+			idleScheduler->usedTicks += elapsedTicks;
+		}
+		else
+		{
+			idleScheduler->leftTicks += elapsedTicks;
+		}
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint32 IdleScheduler::getUsedSlackUS()
+{
+	IdleScheduler idleScheduler = IdleScheduler::getInstance();
+
+	return idleScheduler->usedTicks * Timer::getResolutionInUS();
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint32 IdleScheduler::getLeftSlackUS()
+{
+	IdleScheduler idleScheduler = IdleScheduler::getInstance();
+
+	return idleScheduler->leftTicks * Timer::getResolutionInUS();
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void IdleScheduler::print(int32 x, int32 y)
+{
+	IdleScheduler idleScheduler = IdleScheduler::getInstance();
+
+	Printer::text("IDLE SCHEDULER", x, y++, NULL);
+	y++;
+
+	Printer::text("Jobs:         ", x, y, NULL);
+	Printer::int32(idleScheduler->registeredJobs, x + 12, y++, NULL);
+	Printer::text("Steps:        ", x, y, NULL);
+	Printer::int32(idleScheduler->jobSteps, x + 12, y++, NULL);
+	Printer::text("Used (us):    ", x, y, NULL);
+	Printer::int32(IdleScheduler::getUsedSlackUS(), x + 12, y++, NULL);
+	Printer::text("Left (us):    ", x, y, NULL);
+	Printer::int32(IdleScheduler::getLeftSlackUS(), x + 12, y++, NULL);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint16 IdleScheduler::computeElapsedTicks(uint16 previousTimerCounter, uint16 currentTimerCounter)
+{
+	// The timer counts down and reloads upon reaching zero
+	if(previousTimerCounter >= currentTimerCounter)
+	{
+		return previousTimerCounter - currentTimerCounter;
+	}
+
+	return previousTimerCounter + (Timer::getTimerCounter() - currentTimerCounter);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void IdleScheduler::constructor()
+{
+	// Always explicitly call the base's constructor
+	Base::constructor();
+
+	for(int16 i = 0; i < __IDLE_SCHEDULER_MAXIMUM_JOBS; i++)
+	{
+		this->jobs[i].owner = NULL;
+		this->jobs[i].job = NULL;
+	}
+
+	this->usedTicks = 0;
+	this->leftTicks = 0;
+	this->jobSteps = 0;
+	this->registeredJobs = 0;
+	this->nextJob = 0;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void IdleScheduler::destructor()
+{
+	// Always explicitly call the base's destructor
+	Base::destructor();
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void IdleScheduler::removeJob(int16 index)
+{
+	this->registeredJobs--;
+
+	for(int16 i = index; i < this->registeredJobs; i++)
+	{
+		this->jobs[i] = this->jobs[i + 1];
+	}
+
+	this->jobs[this->registeredJobs].owner = NULL;
+	this->jobs[this->registeredJobs].job = NULL;
+
+	if(index < this->nextJob)
+	{
+		this->nextJob--;
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
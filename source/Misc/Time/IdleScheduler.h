@@ -0,0 +1,113 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+#ifndef IDLE_SCHEDULER_H_
+#define IDLE_SCHEDULER_H_
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <ListenerObject.h>
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#ifndef __IDLE_SCHEDULER_MAXIMUM_JOBS
+#define __IDLE_SCHEDULER_MAXIMUM_JOBS				8
+#endif
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DATA
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// A deferrable job that performs a small step of work
+/// @param owner: Object that registered the job
+/// @return True if there is still work pending; false otherwise
+/// @memberof IdleScheduler
+typedef bool (*IdleJob)(Object owner);
+
+/// Registry of an idle job
+/// @memberof IdleScheduler
+typedef struct IdleJobRegistry
+{
+	/// Object that registered the job
+	Object owner;
+
+	/// Job to run
+	IdleJob job;
+
+} IdleJobRegistry;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DECLARATION
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Class IdleScheduler
+///
+/// Inherits from ListenerObject
+///
+/// Runs deferrable jobs in the slack between the end of a game frame and the start of the next one.
+/// The jobs are run round robin, one step at a time, and the CPU is halted once none of them has
+/// pending work. Each job step must be shorter than the timer's interrupt period for the slack
+/// measurements to be accurate.
+singleton class IdleScheduler : ListenerObject
+{
+	/// @protectedsection
+
+	/// Registered jobs
+	IdleJobRegistry jobs[__IDLE_SCHEDULER_MAXIMUM_JOBS];
+
+	/// Timer ticks spent running jobs during the last game frame's slack
+	uint32 usedTicks;
+
+	/// Timer ticks spent halted during the last game frame's slack
+	uint32 leftTicks;
+
+	/// Job steps run during the last game frame's slack
+	uint16 jobSteps;
+
+	/// Number of registered jobs
+	uint8 registeredJobs;
+
+	/// Index of the next job to run
+	uint8 nextJob;
+
+	/// @publicsection
+
+	/// Register a job to run in the game frames' slack.
+	/// @param owner: Object to pass to the job
+	/// @param job: Job to run
+	/// @return True if the job was registered
+	static bool registerJob(Object owner, IdleJob job);
+
+	/// Unregister a job.
+	/// @param owner: Object that registered the job
+	/// @param job: Job to unregister; NULL to unregister all the jobs of the owner
+	static void unregisterJob(Object owner, IdleJob job);
+
+	/// Run the registered jobs until the next game frame starts.
+	static void run();
+
+	/// Retrieve the slack used by the jobs during the last game frame.
+	/// @return Used slack in microseconds
+	static uint32 getUsedSlackUS();
+
+	/// Retrieve the slack left idle during the last game frame.
+	/// @return Idle slack in microseconds
+	static uint32 getLeftSlackUS();
+
+	/// Print the scheduler's statistics.
+	/// @param x: Screen x coordinate where to print
+	/// @param y: Screen y coordinate where to print
+	static void print(int32 x, int32 y);
+}
+
+#endif
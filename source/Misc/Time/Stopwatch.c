@@ -49,7 +49,7 @@ void Stopwatch::destructor()
 
 void Stopwatch::reset()
 {
-	this->interrupts = 0;
+	this->interrupts = StopwatchManager::getInterrupts(StopwatchManager::getInstance());
 	this->milliSeconds = 0;
 	this->timerCounter = Timer::getTimerCounter(Timer::getInstance());
 	this->timeProportion = Timer::getTargetTimePerInterruptInMS(Timer::getInstance()) / (float)this->timerCounter;
@@ -58,22 +58,18 @@ void Stopwatch::reset()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
-void Stopwatch::update()
-{
-	this->interrupts++;
-}
-
-//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
-
 float Stopwatch::lap()
 {
 	Timer::disable(Timer::getInstance());
 
 	uint16 currentTimerCounter = Timer::getCurrentTimerCounter();
 
+	uint32 totalInterrupts = StopwatchManager::getInterrupts(StopwatchManager::getInstance());
+	uint32 interrupts = totalInterrupts - this->interrupts;
+
 	uint16 timerCounter = 0;
 
-	if(0 == this->interrupts)
+	if(0 == interrupts)
 	{
 		if(currentTimerCounter > this->previousTimerCounter)
 		{
@@ -84,19 +80,19 @@ float Stopwatch::lap()
 			timerCounter = this->previousTimerCounter - currentTimerCounter;
 		}
 	}
-	else if(1 == this->interrupts)
+	else if(1 == interrupts)
 	{
 		timerCounter = this->previousTimerCounter + (this->timerCounter - currentTimerCounter);
 	}
 	else
 	{
 		timerCounter = this->previousTimerCounter + (this->timerCounter - currentTimerCounter);
-		timerCounter += (this->interrupts - 1) * this->timerCounter;
+		timerCounter += (interrupts - 1) * this->timerCounter;
 	}
 
 	float elapsedTime = timerCounter * this->timeProportion;
 
-	this->interrupts = 0;
+	this->interrupts = totalInterrupts;
 
 	this->previousTimerCounter = currentTimerCounter;
 
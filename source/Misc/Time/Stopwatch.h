@@ -32,7 +32,7 @@ class Stopwatch : ListenerObject
 	/// Elapsed time in milliseconds
 	uint32 milliSeconds;
 
-	/// Interrupts counter
+	/// Stopwatch manager's interrupts count at the last lap
 	uint32 interrupts;
 
 	/// Timer counter's configuration value
@@ -55,9 +55,6 @@ class Stopwatch : ListenerObject
 	/// Reset the state of the stopwatch.
 	void reset();
 
-	/// Update the state of the stopwatch.
-	void update();
-
 	/// Register a new lap.
 	/// @return Elapsed time during the last lap
 	float lap();
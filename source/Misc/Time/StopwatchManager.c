@@ -75,15 +75,14 @@ secure void StopwatchManager::unregister(Stopwatch stopwatch)
 
 secure void StopwatchManager::update()
 {
-	if(isDeleted(this->stopwatches))
-	{
-		return;
-	}
+	this->interrupts++;
+}
 
-	for(VirtualNode node = this->stopwatches->head; node ; node = node->next)
-	{
-		Stopwatch::update(node->data);
-	}
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+uint32 StopwatchManager::getInterrupts()
+{
+	return this->interrupts;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -101,6 +100,8 @@ void StopwatchManager::constructor()
 
 	// Create the stopwatch list
 	this->stopwatches = new VirtualList();
+
+	this->interrupts = 0;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
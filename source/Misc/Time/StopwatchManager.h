@@ -38,6 +38,9 @@ singleton class StopwatchManager : Object
 	// Linked list of Stopwatches
 	VirtualList stopwatches;
 
+	/// Timer interrupts since the manager was created
+	uint32 interrupts;
+
 	/// @publicsection
 
 	/// Reset all the registered stopwatches.
@@ -51,8 +54,12 @@ singleton class StopwatchManager : Object
 	/// @param clock: Stopwatch to unregister
 	void unregister(Stopwatch clock);
 
-	/// Update the stopwatches.
+	/// Count a timer interrupt, the stopwatches work out their elapsed interrupts from it when lapping.
 	void update();
+
+	/// Retrieve the number of timer interrupts since the manager was created.
+	/// @return Number of timer interrupts
+	uint32 getInterrupts();
 }
 
 #endif
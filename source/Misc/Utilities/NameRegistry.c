@@ -0,0 +1,174 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <string.h>
+
+#include <DebugConfig.h>
+#include <Printer.h>
+
+#include "NameRegistry.h"
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' ATTRIBUTES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static char _names[__NAME_REGISTRY_MAXIMUM_NAMES][__NAME_REGISTRY_MAXIMUM_NAME_LENGTH + 1];
+static uint16 _hashes[__NAME_REGISTRY_MAXIMUM_NAMES];
+static uint16 _references[__NAME_REGISTRY_MAXIMUM_NAMES];
+static uint16 _usedNames = 0;
+static uint16 _peakUsedNames = 0;
+static uint16 _overflows = 0;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PUBLIC STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static NameId NameRegistry::intern(const char* name)
+{
+	if(NULL == name)
+	{
+		return __NO_NAME_ID;
+	}
+
+	NameId nameId = NameRegistry::find(name);
+
+	if(__NO_NAME_ID != nameId)
+	{
+		_references[nameId - 1]++;
+		return nameId;
+	}
+
+	for(int16 i = 0; i < __NAME_REGISTRY_MAXIMUM_NAMES; i++)
+	{
+		if(0 == _references[i])
+		{
+			strncpy(_names[i], name, __NAME_REGISTRY_MAXIMUM_NAME_LENGTH);
+			_names[i][__NAME_REGISTRY_MAXIMUM_NAME_LENGTH] = '\0';
+			_hashes[i] = NameRegistry::hash(name);
+			_references[i] = 1;
+
+			_usedNames++;
+
+			if(_peakUsedNames < _usedNames)
+			{
+				_peakUsedNames = _usedNames;
+			}
+
+			return i + 1;
+		}
+	}
+
+	_overflows++;
+
+	return __NO_NAME_ID;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void NameRegistry::release(NameId nameId)
+{
+	if(__NO_NAME_ID == nameId || __NAME_REGISTRY_MAXIMUM_NAMES < nameId)
+	{
+		return;
+	}
+
+	NM_ASSERT(0 < _references[nameId - 1], "NameRegistry::release: name not in use");
+
+	if(0 == _references[nameId - 1])
+	{
+		return;
+	}
+
+	_references[nameId - 1]--;
+
+	if(0 == _references[nameId - 1])
+	{
+		_names[nameId - 1][0] = '\0';
+		_usedNames--;
+	}
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static NameId NameRegistry::find(const char* name)
+{
+	if(NULL == name)
+	{
+		return __NO_NAME_ID;
+	}
+
+	uint16 hash = NameRegistry::hash(name);
+
+	for(int16 i = 0; i < __NAME_REGISTRY_MAXIMUM_NAMES; i++)
+	{
+		if(0 != _references[i] && hash == _hashes[i] && !strncmp(name, _names[i], __NAME_REGISTRY_MAXIMUM_NAME_LENGTH))
+		{
+			return i + 1;
+		}
+	}
+
+	return __NO_NAME_ID;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static const char* NameRegistry::getName(NameId nameId)
+{
+	if(__NO_NAME_ID == nameId || __NAME_REGISTRY_MAXIMUM_NAMES < nameId || 0 == _references[nameId - 1])
+	{
+		return NULL;
+	}
+
+	return _names[nameId - 1];
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void NameRegistry::print(int32 x, int32 y)
+{
+	Printer::text("NAME REGISTRY", x, y++, NULL);
+	y++;
+
+	Printer::text("Size:", x, y, NULL);
+	Printer::int32(__NAME_REGISTRY_MAXIMUM_NAMES, x + 12, y++, NULL);
+	Printer::text("Used:         ", x, y, NULL);
+	Printer::int32(_usedNames, x + 12, y++, NULL);
+	Printer::text("Peak:         ", x, y, NULL);
+	Printer::int32(_peakUsedNames, x + 12, y++, NULL);
+	Printer::text("Overflows:    ", x, y, NULL);
+	Printer::int32(_overflows, x + 12, y++, NULL);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' PRIVATE STATIC METHODS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint16 NameRegistry::hash(const char* name)
+{
+	uint16 hash = 0;
+
+	for(int16 i = 0; i < __NAME_REGISTRY_MAXIMUM_NAME_LENGTH && '\0' != name[i]; i++)
+	{
+		hash = (hash << 5) - hash + (uint8)name[i];
+	}
+
+	return hash;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -0,0 +1,81 @@
+/*
+ * VUEngine Core
+ *
+ * © Jorge Eremiev <jorgech3@gmail.com> and Christian Radke <c.radke@posteo.de>
+ *
+ * For the full copyright and license information, please view the LICENSE file
+ * that was distributed with this source code.
+ */
+
+#ifndef NAME_REGISTRY_H_
+#define NAME_REGISTRY_H_
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// INCLUDES
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#include <Object.h>
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' MACROS
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+#ifndef __NAME_REGISTRY_MAXIMUM_NAMES
+#define __NAME_REGISTRY_MAXIMUM_NAMES				64
+#endif
+
+#define __NAME_REGISTRY_MAXIMUM_NAME_LENGTH			16
+
+/// Id of no name
+#define __NO_NAME_ID								0
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DATA
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Id of an interned name
+/// @memberof NameRegistry
+typedef uint16 NameId;
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+// CLASS' DECLARATION
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+/// Class NameRegistry
+///
+/// Inherits from Object
+///
+/// Implements a global symbol table that interns names, so that objects that share a name share
+/// its storage too and their names can be compared by id instead of character by character.
+/// Interned names are reference counted and their slots are reused once no longer referenced.
+static class NameRegistry : Object
+{
+	/// @publicsection
+
+	/// Intern a name, registering it if it is not yet in the table.
+	/// Each call must be balanced by a call to NameRegistry::release.
+	/// @param name: Name to intern
+	/// @return Id of the interned name; __NO_NAME_ID if the name is NULL or the table is full
+	static NameId intern(const char* name);
+
+	/// Release a reference to an interned name.
+	/// @param nameId: Id of the name to release
+	static void release(NameId nameId);
+
+	/// Find the id of a name without interning it.
+	/// @param name: Name to look for
+	/// @return Id of the name; __NO_NAME_ID if the name has not been interned
+	static NameId find(const char* name);
+
+	/// Retrieve the interned name with the provided id.
+	/// @param nameId: Id of the name to retrieve
+	/// @return Pointer to the interned name; NULL if the id is not in use
+	static const char* getName(NameId nameId);
+
+	/// Print the registry's statistics.
+	/// @param x: Screen x coordinate where to print
+	/// @param y: Screen y coordinate where to print
+	static void print(int32 x, int32 y);
+}
+
+#endif
@@ -12,27 +12,34 @@
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
 #include <BehaviorManager.h>
+#include <BgmapSpaceAllocator.h>
 #include <BodyManager.h>
 #include <Camera.h>
 #include <CameraEffectManager.h>
 #include <TileSetManager.h>
 #include <Clock.h>
 #include <ColliderManager.h>
+#include <FrameArena.h>
 #include <FrameBuffers.h>
 #include <FrameRate.h>
+#include <IdleScheduler.h>
 #include <Keypad.h>
 #include <MessageDispatcher.h>
 #include <MutatorManager.h>
+#include <NameRegistry.h>
 #include <ParamTableManager.h>
 #include <Printer.h>
 #include <Profiler.h>
 #include <SpriteManager.h>
 #include <StopwatchManager.h>
 #include <Stage.h>
+#include <StreamingTelemetry.h>
 #include <Telegram.h>
+#include <TextureUploadQueue.h>
 #include <ToolState.h>
 #include <VUEngine.h>
 #include <SoundUnit.h>
+#include <SoundVoiceAllocator.h>
 #include <WireframeManager.h>
 
 #include "GameState.h"
@@ -532,6 +539,21 @@ bool GameState::propagateMessage(int32 message)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+bool GameState::propagateSubscribedMessage(int32 message)
+{
+	if(NULL == this->stage)
+	{
+		return false;
+	}
+
+	return 
+		Stage::propagateSubscribedMessage(this->stage, message) 
+		|| 
+		UIContainer::propagateSubscribedMessage(this->uiContainer, message);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 bool GameState::propagateString(const char* string)
 {
 	return 
@@ -694,7 +716,7 @@ void GameState::fadeOut(uint16 fadeDelay)
 		Camera::getInstance(),
 		kFadeTo, // effect type
 		0, // initial delay (in ms)
-		targetDisplayColorConfig, // target brightness
+		&targetDisplayColorConfig, // target brightness
 		fadeDelay, // delay between fading steps (in ms)
 		ListenerObject::safeCast(this) // callback scope
 	);
@@ -865,6 +887,7 @@ void GameState::render(bool deferred)
 void GameState::focusCamera()
 {
 	Camera::focus(Camera::getInstance());
+	Camera::updateEffects(Camera::getInstance());
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -952,7 +975,28 @@ void GameState::simulatePhysics()
 		return;
 	}
 
-	BodyManager::update(this->componentManagers[kPhysicsComponent]);
+	BodyManager bodyManager = BodyManager::safeCast(this->componentManagers[kPhysicsComponent]);
+
+	if
+	(
+		0 == BodyManager::getFixedTimeStep(bodyManager) 
+		|| 
+		!this->processCollisions || isDeleted(this->componentManagers[kColliderComponent])
+	)
+	{
+		BodyManager::update(bodyManager);
+		return;
+	}
+
+	// In fixed time step mode, the collisions are processed after each step against the physical positions,
+	// so fast bodies cannot go through each other in between the steps that a game frame spans
+	for(uint16 steps = BodyManager::prepareFixedTimeSteps(bodyManager); 0 < steps; steps--)
+	{
+		BodyManager::simulateFixedTimeStep(bodyManager);
+		ColliderManager::update(this->componentManagers[kColliderComponent]);
+	}
+
+	BodyManager::interpolate(bodyManager);
 }
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
@@ -980,6 +1024,17 @@ void GameState::processCollisions()
 		return;
 	}
 
+	// The collisions have already been processed after each fixed time step
+	if
+	(
+		this->updatePhysics && !isDeleted(this->componentManagers[kPhysicsComponent])
+		&&
+		0 != BodyManager::getFixedTimeStep(this->componentManagers[kPhysicsComponent])
+	)
+	{
+		return;
+	}
+
 	ColliderManager::update(this->componentManagers[kColliderComponent]);
 }
 
@@ -1032,6 +1087,11 @@ void GameState::stream(bool complete)
 		}
 		else if(this->stream)
 		{
+	#ifdef __ENABLE_STREAMING_TELEMETRY
+			// Close the previous game frame, including the streaming done during its slack
+			StreamingTelemetry::endFrame(Stage::getStreamingPhase(this->stage));
+	#endif
+
 	#ifdef __ENABLE_PROFILER
 			if(!VUEngine::hasGameFrameStarted())
 			{
@@ -1044,7 +1104,8 @@ void GameState::stream(bool complete)
 				{
 					VUEngine::fireEvent(VUEngine::getInstance(), kEventLowStreamingRate);
 				}
-				else
+				// When the frame rate is locked, the remaining streaming runs in the game frame's slack
+				else if(!this->lockFrameRate)
 				{				
 					while(Stage::stream(this->stage) && !VUEngine::hasGameFrameStarted());
 				}
@@ -1065,6 +1126,19 @@ void GameState::stream(bool complete)
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+bool GameState::streamWhileIdle()
+{
+	if(!this->stream || isDeleted(this->stage))
+	{
+		return false;
+	}
+
+	// The slack can end at any moment, so the stage is streamed in bounded steps
+	return Stage::streamStep(this->stage);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 void GameState::updateSounds()
 {
 	if(!VUEngine::hasGameFrameStarted())
@@ -1210,6 +1284,34 @@ void GameState::debugging()
 #endif
 #endif
 
+#ifdef __DEBUGGING_FRAME_ARENA
+	FrameArena::print(1, 1);
+#endif
+
+#ifdef __DEBUGGING_IDLE_SCHEDULER
+	IdleScheduler::print(1, 1);
+#endif
+
+#ifdef __DEBUGGING_TEXTURE_UPLOADS
+	TextureUploadQueue::print(1, 1);
+#endif
+
+#ifdef __DEBUGGING_BGMAP_SPACE_ALLOCATOR
+	BgmapSpaceAllocator::print(1, 1);
+#endif
+
+#ifdef __DEBUGGING_SOUND_VOICES
+	SoundVoiceAllocator::print(1, 1);
+#endif
+
+#ifdef __DEBUGGING_NAME_REGISTRY
+	NameRegistry::print(1, 1);
+#endif
+
+#ifdef __DEBUGGING_MESSAGE_PROPAGATION
+	Container::printMessagePropagationStatistics(1, 1);
+#endif
+
 #ifdef __DEBUGGING_TILE_MEMORY
 	TileSetManager::print(1, 1);
 #endif
@@ -1251,9 +1353,23 @@ void GameState::debugging()
 	SoundManager::print(this->componentManagers[kSoundComponent], 1, 1);
 #endif
 
+#ifdef __DEBUGGING_BEHAVIORS
+	ComponentManager::print(this->componentManagers[kBehaviorComponent], 1, 1);
+#endif
+
+#ifdef __DEBUGGING_MUTATORS
+	ComponentManager::print(this->componentManagers[kMutatorComponent], 1, 1);
+#endif
+
 #ifdef __DEBUGGING_STREAMING
 	Stage::print(this->stage, 1, 1);
 #endif
+
+#ifdef __ENABLE_STREAMING_TELEMETRY
+#ifdef __DEBUGGING_STREAMING_TELEMETRY
+	StreamingTelemetry::print(1, 1);
+#endif
+#endif
 }
 #endif	
 #endif	
@@ -185,6 +185,12 @@ class GameState : State
 	/// @return True if some actor processed the message
 	bool propagateMessage(int32 message);
 
+	/// Propagate an integer message through the parenting hierarchy of the stage, only reaching
+	/// the containers that subscribed to it.
+	/// @param message: The message to propagate
+	/// @return True if some actor processed the message
+	bool propagateSubscribedMessage(int32 message);
+
 	/// Propagate a string through the whole parenting hierarchy of the stage (children, grand children, etc.).
 	/// @param string: The string to propagate
 	/// @return True if some actor processed the string
@@ -213,6 +219,10 @@ class GameState : State
 	/// @param complete: If true, force to completely stream in and out actors
 	void stream(bool complete);
 
+	/// Run a step of the streaming process in the game frame's slack.
+	/// @return True if there is still streaming to do; false otherwise
+	bool streamWhileIdle();
+
 	/// Check if the framerate is locked or not
 	/// @return True if the framerate is locked; false otherwise
 	bool lockFrameRate();
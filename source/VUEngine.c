@@ -17,15 +17,18 @@
 #include <Clock.h>
 #include <ClockManager.h>
 #include <DebugConfig.h>
+#include <FrameArena.h>
 #include <FrameRate.h>
 #include <GameState.h>
 #include <Hardware.h>
+#include <IdleScheduler.h>
 #include <Keypad.h>
 #include <Profiler.h>
 #include <Singleton.h>
 #include <Stage.h>
 #include <StateMachine.h>
 #include <Telegram.h>
+#include <TextureUploadQueue.h>
 #include <ToolState.h>
 #include <Timer.h>
 #include <VirtualList.h>
@@ -191,8 +194,82 @@ static void VUEngine::setGameFrameRate(uint16 gameFrameRate)
 	gameFrameRate = 12;
 #endif
 
-	FrameRate::setTargetFPS(FrameRate::getInstance(), gameFrameRate);
-	DisplayUnit::setFrameCycle(__MAXIMUM_FPS / gameFrameRate - 1);
+	VUEngine vuEngine = VUEngine::getInstance();
+
+	vuEngine->gameFrameRate = gameFrameRate;
+	vuEngine->overloadedSeconds = 0;
+	vuEngine->steadySeconds = 0;
+
+	VUEngine::applyGameFrameRate(vuEngine, gameFrameRate);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint16 VUEngine::getGameFrameRate()
+{
+	VUEngine vuEngine = VUEngine::getInstance();
+
+	return vuEngine->gameFrameRate;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static uint16 VUEngine::getGovernedGameFrameRate()
+{
+	VUEngine vuEngine = VUEngine::getInstance();
+
+	return vuEngine->governedGameFrameRate;
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void VUEngine::enableFrameRateGovernor()
+{
+	VUEngine vuEngine = VUEngine::getInstance();
+
+	if(vuEngine->frameRateGovernorEnabled)
+	{
+		return;
+	}
+
+	vuEngine->frameRateGovernorEnabled = true;
+	vuEngine->overloadedSeconds = 0;
+	vuEngine->steadySeconds = 0;
+	vuEngine->strained = false;
+	vuEngine->minimumSlackUS = 0xFFFFFFFF;
+
+	FrameRate::addEventListener(FrameRate::getInstance(), ListenerObject::safeCast(vuEngine), kEventFramerateReady);
+	VUEngine::addEventListener(vuEngine, ListenerObject::safeCast(vuEngine), kEventLowStreamingRate);
+
+#ifdef __ENABLE_PROFILER
+	Profiler::addEventListener(Profiler::getInstance(), ListenerObject::safeCast(vuEngine), kEventProfilerBudgetExceeded);
+#endif
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+static void VUEngine::disableFrameRateGovernor()
+{
+	VUEngine vuEngine = VUEngine::getInstance();
+
+	if(!vuEngine->frameRateGovernorEnabled)
+	{
+		return;
+	}
+
+	vuEngine->frameRateGovernorEnabled = false;
+
+	FrameRate::removeEventListener(FrameRate::getInstance(), ListenerObject::safeCast(vuEngine), kEventFramerateReady);
+	VUEngine::removeEventListener(vuEngine, ListenerObject::safeCast(vuEngine), kEventLowStreamingRate);
+
+#ifdef __ENABLE_PROFILER
+	Profiler::removeEventListener(Profiler::getInstance(), ListenerObject::safeCast(vuEngine), kEventProfilerBudgetExceeded);
+#endif
+
+	if(vuEngine->governedGameFrameRate != vuEngine->gameFrameRate)
+	{
+		VUEngine::applyGameFrameRate(vuEngine, vuEngine->gameFrameRate);
+	}
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -252,15 +329,48 @@ bool VUEngine::onEvent(ListenerObject eventFirer, uint16 eventCode)
 	{
 		case kEventDisplayUnitFrameStart:
 		{
+#ifdef __ENABLE_PROFILER
+			Profiler::lap(kProfilerLapTypeStartInterrupt, NULL);
+#endif
+
 			VUEngine::frameStarted(this, __MILLISECONDS_PER_SECOND / __MAXIMUM_FPS);
 
+#ifdef __ENABLE_PROFILER
+			Profiler::lap(kProfilerLapTypeVIPInterruptFRAMESTARTProcess, PROCESS_NAME_FRAME_START);
+#endif
+
 			return true;
 		}
 
 		case kEventDisplayUnitGameStart:
 		{
+#ifdef __ENABLE_PROFILER
+			Profiler::lap(kProfilerLapTypeStartInterrupt, NULL);
+#endif
+
 			VUEngine::gameFrameStarted(this, DisplayUnit::getGameFrameDuration(eventFirer));
 
+#ifdef __ENABLE_PROFILER
+			Profiler::lap(kProfilerLapTypeVIPInterruptGAMESTARTProcess, PROCESS_NAME_GAME_START);
+#endif
+
+			return true;
+		}
+
+		case kEventFramerateReady:
+		{
+			VUEngine::governFrameRate(this);
+
+			return true;
+		}
+
+		case kEventLowStreamingRate:
+#ifdef __ENABLE_PROFILER
+		case kEventProfilerBudgetExceeded:
+#endif
+		{
+			this->strained = true;
+
 			return true;
 		}
 
@@ -360,6 +470,13 @@ void VUEngine::constructor()
 	this->isPaused = false;
 	this->activeToolState = NULL;
 	this->saveDataManager = NULL;
+	this->gameFrameRate = __TARGET_FPS;
+	this->governedGameFrameRate = __TARGET_FPS;
+	this->minimumSlackUS = 0xFFFFFFFF;
+	this->overloadedSeconds = 0;
+	this->steadySeconds = 0;
+	this->strained = false;
+	this->frameRateGovernorEnabled = false;
 }
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -431,8 +548,16 @@ void VUEngine::changedState()
 	this->currentGameCycleEnded = true;
 	this->gameFrameStarted = true;
 
+	// Only the current game state streams in the game frames' slack
+	IdleScheduler::unregisterJob((Object)this->currentGameState, (IdleJob)&GameState::streamWhileIdle);
+
 	this->currentGameState = GameState::safeCast(StateMachine::getCurrentState(this->stateMachine));
 
+	if(NULL != this->currentGameState)
+	{
+		IdleScheduler::registerJob(Object::safeCast(this->currentGameState), (IdleJob)&GameState::streamWhileIdle);
+	}
+
 	DisplayUnit::startDrawing(DisplayUnit::getInstance());
 	DisplayUnit::startDisplaying(DisplayUnit::getInstance());
 
@@ -450,6 +575,7 @@ void VUEngine::frameStarted(uint16 gameFrameDuration)
 	totalTime += gameFrameDuration;
 
 	Timer::frameStarted(gameFrameDuration * __MICROSECONDS_PER_MILLISECOND);
+	TextureUploadQueue::frameStarted();
 
 	if(__MILLISECONDS_PER_SECOND <= totalTime)
 	{
@@ -557,8 +683,6 @@ void VUEngine::startGameFrame()
 #endif
 
 #ifdef __ENABLE_PROFILER
-	Hardware::disableInterrupts();
-
 	Profiler::start();
 #endif
 }
@@ -581,13 +705,23 @@ void VUEngine::endGameFrame()
 	this->currentGameCycleEnded = true;
 
 #ifdef __ENABLE_PROFILER
-	Hardware::enableInterrupts();
+	Profiler::end();
 #endif
 
+	// Anything allocated in the frame arena is released at once
+	FrameArena::reset();
+
 	if(NULL != this->currentGameState && GameState::lockFrameRate(this->currentGameState))
 	{
-		//  Wait for the next game start
-		while(!VUEngine::hasGameFrameStarted());
+		// Put the slack until the next game start to use
+		IdleScheduler::run();
+
+		uint32 slackUS = IdleScheduler::getUsedSlackUS() + IdleScheduler::getLeftSlackUS();
+
+		if(this->minimumSlackUS > slackUS)
+		{
+			this->minimumSlackUS = slackUS;
+		}
 	}
 
 	FrameRate::update(FrameRate::getInstance());
@@ -603,6 +737,10 @@ secure void VUEngine::run(GameState currentGameState)
 		return;
 	}
 
+#ifdef __DEBUG
+	Math::checkErrorBounds();
+#endif
+
 	DisplayUnit::addEventListener(DisplayUnit::getInstance(), ListenerObject::safeCast(this), kEventDisplayUnitFrameStart);
 	DisplayUnit::addEventListener(DisplayUnit::getInstance(), ListenerObject::safeCast(this), kEventDisplayUnitGameStart);
 
@@ -636,6 +774,85 @@ void VUEngine::cleanUp()
 
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 
+void VUEngine::applyGameFrameRate(uint16 gameFrameRate)
+{
+	this->governedGameFrameRate = gameFrameRate;
+	this->minimumSlackUS = 0xFFFFFFFF;
+	this->strained = false;
+
+	FrameRate::setTargetFPS(FrameRate::getInstance(), gameFrameRate);
+	DisplayUnit::setFrameCycle(__MAXIMUM_FPS / gameFrameRate - 1);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
+void VUEngine::governFrameRate()
+{
+	FrameRate frameRate = FrameRate::getInstance();
+
+	uint16 targetFPS = FrameRate::getTargetFPS(frameRate);
+	uint16 FPS = FrameRate::getFPS(frameRate);
+
+	uint32 minimumSlackUS = this->minimumSlackUS;
+	bool strained = this->strained;
+
+	this->minimumSlackUS = 0xFFFFFFFF;
+	this->strained = false;
+
+	if(FPS + __FRAME_RATE_GOVERNOR_DROPPED_FRAMES < targetFPS)
+	{
+		this->steadySeconds = 0;
+
+		if(__FRAME_RATE_GOVERNOR_OVERLOADED_SECONDS > ++this->overloadedSeconds)
+		{
+			return;
+		}
+
+		this->overloadedSeconds = 0;
+
+		// Each step down adds one more display frame to the game frame
+		uint16 lowerGameFrameRate = __MAXIMUM_FPS / (__MAXIMUM_FPS / this->governedGameFrameRate + 1);
+
+		if(__FRAME_RATE_GOVERNOR_MINIMUM_FPS <= lowerGameFrameRate)
+		{
+			VUEngine::applyGameFrameRate(this, lowerGameFrameRate);
+		}
+
+		return;
+	}
+
+	this->overloadedSeconds = 0;
+
+	// Seconds in which a profiled phase went over its budget or the streaming fell behind do not count
+	// towards the recovery, even if no game frame was dropped
+	if(strained || targetFPS > FPS)
+	{
+		this->steadySeconds = 0;
+		return;
+	}
+
+	if(this->governedGameFrameRate >= this->gameFrameRate || __FRAME_RATE_GOVERNOR_STEADY_SECONDS > ++this->steadySeconds)
+	{
+		return;
+	}
+
+	this->steadySeconds = 0;
+
+	uint16 higherGameFrameRate = Math::min(__MAXIMUM_FPS / (__MAXIMUM_FPS / this->governedGameFrameRate - 1), this->gameFrameRate);
+
+	// The slack is only measured when the frame rate is locked, otherwise the steady seconds have to suffice
+	uint32 requiredSlackUS = __MICROSECONDS_PER_SECOND / this->governedGameFrameRate - __MICROSECONDS_PER_SECOND / higherGameFrameRate;
+
+	if(0xFFFFFFFF != minimumSlackUS && requiredSlackUS > minimumSlackUS)
+	{
+		return;
+	}
+
+	VUEngine::applyGameFrameRate(this, higherGameFrameRate);
+}
+
+//——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // GLOBAL FUNCTIONS
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
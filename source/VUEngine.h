@@ -39,6 +39,8 @@ class VUEngine;
 #define PROCESS_NAME_COLLISIONS				"COLLISIONS"
 #define PROCESS_NAME_COMMUNICATE			"COMMUNICATE"
 #define PROCESS_NAME_EXECUTE				"EXECUTE"
+#define PROCESS_NAME_FRAME_START			"FRAME START"
+#define PROCESS_NAME_GAME_START				"GAME START"
 #define PROCESS_NAME_INPUT					"INPUT"
 #define PROCESS_NAME_MESSAGES				"MESSAGES"
 #define PROCESS_NAME_MUTATORS				"MUTATORS"
@@ -52,6 +54,22 @@ class VUEngine;
 #define PROCESS_NAME_UPDATE_STAGE			"UPD STAGE"
 #define PROCESS_NAME_VRAM_WRITE				"VRAM WRITE"
 
+#ifndef __FRAME_RATE_GOVERNOR_MINIMUM_FPS
+#define __FRAME_RATE_GOVERNOR_MINIMUM_FPS			16
+#endif
+
+#ifndef __FRAME_RATE_GOVERNOR_DROPPED_FRAMES
+#define __FRAME_RATE_GOVERNOR_DROPPED_FRAMES		2
+#endif
+
+#ifndef __FRAME_RATE_GOVERNOR_OVERLOADED_SECONDS
+#define __FRAME_RATE_GOVERNOR_OVERLOADED_SECONDS	2
+#endif
+
+#ifndef __FRAME_RATE_GOVERNOR_STEADY_SECONDS
+#define __FRAME_RATE_GOVERNOR_STEADY_SECONDS		5
+#endif
+
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
 // CLASS' DECLARATION
 //——————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————————
@@ -86,6 +104,27 @@ singleton class VUEngine : ListenerObject
 	/// Currently active tool state
 	ToolState activeToolState;
 
+	/// Game frame rate requested through setGameFrameRate, the frame rate governor never exceeds it
+	uint16 gameFrameRate;
+
+	/// Game frame rate currently set by the frame rate governor
+	uint16 governedGameFrameRate;
+
+	/// Minimum slack left at the end of the game frames during the current second in microseconds
+	uint32 minimumSlackUS;
+
+	/// Consecutive seconds during which too many game frames were dropped
+	uint8 overloadedSeconds;
+
+	/// Consecutive seconds during which no game frame was dropped
+	uint8 steadySeconds;
+
+	/// Flag raised when a profiled phase exceeds its budget or the streaming falls behind
+	bool strained;
+
+	/// If true, the game frame rate is adjusted automatically to the load
+	bool frameRateGovernorEnabled;
+
 	/// @publicsection
 
 	/// Check if the next game frame has started.
@@ -124,6 +163,22 @@ singleton class VUEngine : ListenerObject
 	/// @param gameFrameRate: New frame rate target
 	static void setGameFrameRate(uint16 gameFrameRate);
 
+	/// Retrieve the target frame rate.
+	/// @return Frame rate target set through setGameFrameRate
+	static uint16 getGameFrameRate();
+
+	/// Retrieve the frame rate at which the game is actually running.
+	/// @return Frame rate target set by the frame rate governor if enabled; the one set through 
+	/// setGameFrameRate otherwise
+	static uint16 getGovernedGameFrameRate();
+
+	/// Let the engine lower the game frame rate when the game frames are overrun during several seconds,
+	/// and raise it back up to the one set through setGameFrameRate once the load has been steady for a while.
+	static void enableFrameRateGovernor();
+
+	/// Stop adjusting the game frame rate to the load and restore the one set through setGameFrameRate.
+	static void disableFrameRateGovernor();
+
 	/// Set the saved data manager.
 	/// @param saveDataManager:: Save data manager to use
 	static void setSaveDataManager(ListenerObject saveDataManager);